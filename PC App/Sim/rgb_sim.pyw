@@ -218,8 +218,8 @@ class RGBSim(QWidget):
         c = self.cfg
         if "count" in cfg:
             v = cfg.get("count",[8,12,12,12])
-            c["count"] = [clamp(int(v[0]),0,50), clamp(int(v[1]),0,50),
-                          clamp(int(v[2]),0,50), clamp(int(v[3]),0,50)]
+            c["count"] = [clamp(int(v[0]),0,300), clamp(int(v[1]),0,300),
+                          clamp(int(v[2]),0,300), clamp(int(v[3]),0,300)]
             self.canvas.set_counts(c["count"])
 
         for k in ("brightness","mode","speed","intensity","width",
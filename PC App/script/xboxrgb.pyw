@@ -3,11 +3,13 @@
 # - Auto-discovers devices via UDP broadcast
 # - Mirrors Web UI controls 1:1 (incl. per-channel Reverse, Master Off, Custom Playlist)
 # - UDP preview/save/reset/get + HTTP fallback to /config/api/* (LED) and /config/smbus/api/* (SMBus)
-# - Live preview with debounce on change
+# - Live preview with debounce on change; sends only changed fields (UDP "patch" op)
+# - Device stats panel (UDP "stats" op, HTTP /config/api/stats fallback)
+# - Multi-unit sync leader: broadcasts the "RGBS" beacon with priority 0
 #
 # Deps: pip install PySide6 requests
 
-import sys, socket, json, time
+import sys, socket, json, time, copy, struct, random
 from dataclasses import dataclass
 from typing import List, Optional
 
@@ -42,17 +44,19 @@ MODES = [
     ("Palette Cycle", 12),
     ("Palette Chase", 13),
     ("Custom (Playlist)", 14),   # NEW
+    ("Temp Reactive", 15),       # CPU temperature (SMBus)
+    ("Fan Reactive", 16),        # fan speed (SMBus)
 ]
 
 # Visibility map (same as Web UI JS showOptsFor)
 VIS = {
-    "colorA":   set(range(0,14)),                # 0..13
-    "colorB":   {8,9,10,12,13},
+    "colorA":   set(range(0,14)) | {15,16},      # 0..13, reactive
+    "colorB":   {8,9,10,12,13,15,16},
     "colorC":   {12,13},
     "colorD":   {12,13},
     "palette":  {12,13},
-    "width":    {3,5,7,8,9,13},
-    "intensity":{3,5,6,7,8,11,12,13},
+    "width":    {3,5,7,8,9,13,16},
+    "intensity":{3,5,6,7,8,11,12,13,15,16},
     # For mode 14 (Custom), we show the Custom group explicitly and leave main sliders visible.
 }
 
@@ -166,6 +170,35 @@ def discover_devices(timeout=1.2, psk: Optional[str]=None, port=DEFAULT_UDP_PORT
     finally:
         sock.close()
 
+# ------------------- Multi-unit sync ----------------------
+# The firmware's 28-byte SyncBeacon (README "Multi-unit sync"), little endian:
+# magic, version, priority, flags, step, sender id, show clock µs, playlist
+# crc, ms into step. Priority 0 outranks every unit, so units in "auto" or
+# "follow" lock their animation clock to this one. No playlist fields: each
+# unit keeps its own step.
+SYNC_FMT = "<4sBBBBIqII"
+SYNC_VER = 1
+SYNC_PRIO_PC = 0
+SYNC_BEACON_MS = 1000
+
+class SyncLeader(object):
+    def __init__(self, port=DEFAULT_UDP_PORT):
+        self.port = port
+        self.id = random.getrandbits(32)
+        self.t0 = time.monotonic()
+        self.sent = 0
+
+    def beacon(self):
+        show_us = int((time.monotonic() - self.t0) * 1000000)
+        pkt = struct.pack(SYNC_FMT, b"RGBS", SYNC_VER, SYNC_PRIO_PC, 0, 0, self.id, show_us, 0, 0)
+        sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        try:
+            sock.setsockopt(socket.SOL_SOCKET, socket.SO_BROADCAST, 1)
+            sock.sendto(pkt, ("255.255.255.255", self.port))
+            self.sent += 1
+        finally:
+            sock.close()
+
 # ------------------- Transport layer ----------------------
 class Transport(object):
     def __init__(self):
@@ -173,6 +206,10 @@ class Transport(object):
         self.udp_port: int = DEFAULT_UDP_PORT
         self.use_udp: bool = True
         self.psk: Optional[str] = None
+        # Delta previews: device config as of generation self.gen
+        self.gen: int = 0
+        self.sent: Optional[dict] = None
+        self.can_patch: bool = True
 
     def target_ok(self) -> bool:
         return bool(self.ip)
@@ -217,7 +254,10 @@ class Transport(object):
                 resp = self.udp_send_recv({"op":"get"}, expect_reply=True)
                 if resp:
                     j = json.loads(resp.decode("utf-8","ignore"))
-                    return j.get("cfg", j)
+                    cfg = j.get("cfg", j)
+                    if j.get("gen"):
+                        self.gen, self.sent = int(j["gen"]), copy.deepcopy(cfg)
+                    return cfg
             except Exception:
                 pass
         # HTTP fallback
@@ -227,10 +267,32 @@ class Transport(object):
         except Exception:
             return default_cfg()
 
+    def _patch(self, cfg) -> bool:
+        """Send only the fields that changed since self.gen ("patch" op)."""
+        delta = {k: v for k, v in cfg.items() if self.sent.get(k) != v}
+        if not delta:
+            return True
+        try:
+            r = json.loads(self.udp_send_recv({"op":"patch","gen":self.gen,"cfg":delta}, timeout=0.6))
+            if r.get("err") == "stale":      # changed elsewhere: resend everything
+                delta = cfg
+                r = json.loads(self.udp_send_recv({"op":"patch","gen":int(r.get("gen", 0)),"cfg":delta}, timeout=0.6))
+        except Exception:
+            return False
+        if r.get("ok"):
+            self.gen = int(r.get("gen", 0))
+            self.sent.update(copy.deepcopy(delta))
+            return True
+        self.can_patch = False               # older firmware without "patch"
+        return False
+
     def preview(self, cfg):
         if self.use_udp and self.target_ok():
+            if self.can_patch and self.sent is not None and self._patch(cfg):
+                return True
             try:
                 self.udp_send_recv({"op":"preview","cfg":cfg}, expect_reply=False)
+                self.sent, self.gen = copy.deepcopy(cfg), 0   # next patch unconditional
                 return True
             except Exception:
                 pass
@@ -244,6 +306,7 @@ class Transport(object):
         if self.use_udp and self.target_ok():
             try:
                 self.udp_send_recv({"op":"save","cfg":cfg}, expect_reply=False)
+                self.sent, self.gen = copy.deepcopy(cfg), 0
                 return True
             except Exception:
                 pass
@@ -266,6 +329,36 @@ class Transport(object):
         except Exception:
             return False
 
+    # ---- Runtime stats (UDP {"op":"stats"} or /config/api/stats) ----
+    def get_stats(self):
+        # Over UDP the document comes one datagram-sized section at a time:
+        # the summary names the sections, which are then merged back into
+        # the same shape /config/api/stats returns.
+        if self.use_udp and self.target_ok():
+            try:
+                j = self._udp_stats(None)
+                if j:
+                    st = j.get("stats", {})
+                    for sec in j.get("sections", []):
+                        part = self._udp_stats(sec)
+                        if not part:
+                            raise ValueError("no reply for section " + sec)
+                        _deep_merge(st, part.get("stats", {}))
+                    return st
+            except Exception:
+                pass
+        return json.loads(self.http_get("/config/api/stats"))
+
+    def _udp_stats(self, section):
+        req = {"op":"stats"}
+        if section:
+            req["section"] = section
+        resp = self.udp_send_recv(req, expect_reply=True)
+        if not resp:
+            return None
+        j = json.loads(resp.decode("utf-8","ignore"))
+        return j if j.get("ok") and "stats" in j else None
+
     # ---- SMBus flags/guard (matches WebUI under /config/smbus/api/...) ----
     def smbus_get_flags(self):
         # Returns dict like {"cpu":bool,"fan":bool,"savedCpu":bool,"savedFan":bool,"guarded":bool,"guardReason":"TypeD",...}
@@ -276,6 +369,52 @@ class Transport(object):
         txt = self.http_post("/config/smbus/api/flags", {"cpu": bool(cpu), "fan": bool(fan)})
         return json.loads(txt)
 
+# ------------------- Stats formatting ---------------------
+def _deep_merge(dst, src):
+    for k, v in src.items():
+        if isinstance(v, dict) and isinstance(dst.get(k), dict):
+            _deep_merge(dst[k], v)
+        else:
+            dst[k] = v
+    return dst
+
+def _hist_str(h):
+    if not h or not h.get("n"):
+        return "-"
+    return "avg %d µs  max %d µs  (n=%d)" % (h.get("avg", 0), h.get("max", 0), h.get("n", 0))
+
+def format_stats(st):
+    """Render the firmware's stats JSON as a compact, readable text block."""
+    r, u = st.get("render", {}), st.get("udp", {})
+    sm, nv, hp = st.get("smbus", {}), st.get("nvs", {}), st.get("heap", {})
+    q = u.get("queue", {})
+    up = st.get("uptimeMs", 0) // 1000
+    L = []
+    L.append("Uptime       %dh %02dm %02ds" % (up // 3600, up // 60 % 60, up % 60))
+    L.append("FPS          %.1f / %s target" % (r.get("fps", 0), r.get("target", "?")))
+    L.append("Frame        " + _hist_str(r.get("frame")))
+    L.append("Jitter       " + _hist_str(r.get("jitter")))
+    L.append("Shown/skip   %d / %d" % (r.get("shown", 0), r.get("skipped", 0)))
+    for name, m in (r.get("modes") or {}).items():
+        L.append("  mode %-9s %s" % (name, _hist_str(m)))
+    for i, c in enumerate(r.get("show") or []):
+        L.append("  CH%d show    %s" % (i + 1, _hist_str(c)))
+    for i, c in enumerate(sm.get("show") or []):
+        L.append("  CH%d show    %s" % (i + 5, _hist_str(c)))
+    L.append("UDP rx       json %d (bad %d)  text %d  ddp %d (gaps %d)" % (
+        u.get("json", 0), u.get("badJson", 0), u.get("plain", 0), u.get("ddp", 0), u.get("ddpGaps", 0)))
+    L.append("UDP queue    deferred %d  coalesced %d  dropped %d  early %d  peak %d" % (
+        q.get("deferred", 0), q.get("coalesced", 0), q.get("dropped", 0), q.get("early", 0), q.get("peak", 0)))
+    L.append("Pending      " + _hist_str(u.get("pending")))
+    L.append("SMBus        attempts %d  ok %d  busy %d%s" % (
+        sm.get("attempts", 0), sm.get("ok", 0), sm.get("busy", 0), "  (guarded)" if sm.get("guarded") else ""))
+    L.append("Bus idle     " + _hist_str(sm.get("waitIdle")))
+    L.append("NVS          writes %d  unchanged %d  requests %d%s" % (
+        nv.get("writes", 0), nv.get("unchanged", 0), nv.get("requests", 0), "  (pending)" if nv.get("pending") else ""))
+    L.append("NVS write    " + _hist_str(nv.get("write")))
+    L.append("Heap         free %d  min %d  largest %d" % (hp.get("free", 0), hp.get("minFree", 0), hp.get("largest", 0)))
+    return "\n".join(L)
+
 # ------------------- Color control widget -----------------
 class ColorField(QWidget):
     def __init__(self, title, initial=0x000000, parent=None):
@@ -353,6 +492,15 @@ class MainWindow(QWidget):
         she.setSingleShot(True)
         she.timeout.connect(self._send_preview)
 
+        self._statsTimer = QTimer(self)
+        self._statsTimer.setInterval(2000)
+        self._statsTimer.timeout.connect(self.refresh_stats)
+
+        self._sync = SyncLeader()
+        self._syncTimer = QTimer(self)
+        self._syncTimer.setInterval(SYNC_BEACON_MS)
+        self._syncTimer.timeout.connect(self._send_sync_beacon)
+
         # auto-discover at startup
         self.rescan_devices(auto=True)
 
@@ -377,6 +525,7 @@ class MainWindow(QWidget):
         self.portEdit.setEnabled(False)
 
         self.loadBtn = QPushButton("Reload from device")
+        self.syncLead = QCheckBox("Lead multi-unit sync (units in sync auto/follow lock to this PC)")
         self.status  = QLabel("status: discovering…")
 
         row = 0
@@ -394,6 +543,7 @@ class MainWindow(QWidget):
         connL.addWidget(self.portEdit, row,2); row += 1
 
         connL.addWidget(self.loadBtn, row,0,1,3); row += 1
+        connL.addWidget(self.syncLead, row,0,1,3); row += 1
         connL.addWidget(self.status,  row,0,1,3)
 
         conn.setLayout(connL)
@@ -521,12 +671,31 @@ class MainWindow(QWidget):
 
         ctrl.setLayout(g)
 
+        # Device stats (read-only telemetry)
+        statsBox = QGroupBox("Device Stats")
+        statsL = QVBoxLayout()
+        statsRow = QHBoxLayout()
+        self.statsBtn  = QPushButton("Refresh stats")
+        self.statsAuto = QCheckBox("Auto-refresh (2 s)")
+        statsRow.addWidget(self.statsBtn)
+        statsRow.addWidget(self.statsAuto)
+        statsRow.addStretch(1)
+        self.statsView = QTextEdit()
+        self.statsView.setReadOnly(True)
+        self.statsView.setLineWrapMode(QTextEdit.NoWrap)
+        self.statsView.setStyleSheet("font-family: Consolas, monospace;")
+        self.statsView.setMinimumHeight(160)
+        statsL.addLayout(statsRow)
+        statsL.addWidget(self.statsView)
+        statsBox.setLayout(statsL)
+
         # Footer (copyright / version if provided)
         self.footer = QLabel("© Darkone Customs 2025")
         self.footer.setAlignment(Qt.AlignCenter)
 
         root.addWidget(conn)
         root.addWidget(ctrl)
+        root.addWidget(statsBox)
         root.addWidget(self.footer)
         self.setLayout(root)
 
@@ -540,6 +709,7 @@ class MainWindow(QWidget):
         self.ipEdit.editingFinished.connect(self._apply_manual)
         self.portEdit.editingFinished.connect(self._apply_manual)
         self.loadBtn.clicked.connect(self.reload_from_device)
+        self.syncLead.stateChanged.connect(self._toggle_sync_lead)
 
         # Controls → debounce preview
         self.mode.currentIndexChanged.connect(self._mode_changed)
@@ -568,6 +738,10 @@ class MainWindow(QWidget):
         self.saveBtn.clicked.connect(self._send_save)
         self.resetBtn.clicked.connect(self._send_reset)
 
+        # Stats
+        self.statsBtn.clicked.connect(self.refresh_stats)
+        self.statsAuto.stateChanged.connect(self._toggle_stats_auto)
+
     # --------------- Discovery / selection ----------------
     def rescan_devices(self, auto=False):
         self.status.setText("status: discovering…")
@@ -710,7 +884,7 @@ class MainWindow(QWidget):
             cfg = self.transport.get_config()
             # force mode sanity
             m = cfg.get("mode", 4)
-            if not isinstance(m, int) or m < 0 or m > 14:
+            if not isinstance(m, int) or m < 0 or m > 16:
                 cfg["mode"] = 4  # Rainbow default
 
             # footer text (copyright + version if provided)
@@ -727,6 +901,35 @@ class MainWindow(QWidget):
         finally:
             QApplication.restoreOverrideCursor()
 
+    def refresh_stats(self):
+        if not self.transport.target_ok():
+            self.statsView.setPlainText("no device target")
+            return
+        try:
+            self.statsView.setPlainText(format_stats(self.transport.get_stats()))
+        except Exception as e:
+            self.statsView.setPlainText(f"stats unavailable: {e}")
+
+    def _toggle_sync_lead(self, _):
+        if self.syncLead.isChecked():
+            self._send_sync_beacon()
+            self._syncTimer.start()
+        else:
+            self._syncTimer.stop()        # units take over after their timeout
+
+    def _send_sync_beacon(self):
+        try:
+            self._sync.beacon()
+        except OSError as e:
+            self.status.setText(f"status: sync beacon failed: {e}")
+
+    def _toggle_stats_auto(self, _):
+        if self.statsAuto.isChecked():
+            self.refresh_stats()
+            self._statsTimer.start()
+        else:
+            self._statsTimer.stop()
+
     def _send_preview(self):
         if not self.transport.target_ok(): return
         cfg = self._ui_to_cfg()
@@ -777,10 +980,12 @@ class MainWindow(QWidget):
         self.paletteCount.setCurrentIndex(pc-1)
 
         c = self.cfg.get("count",[50,50,50,50]) + [50,50,50,50]
-        self.c0.setValue(clamp(c[0],0,50))
-        self.c1.setValue(clamp(c[1],0,50))
-        self.c2.setValue(clamp(c[2],0,50))
-        self.c3.setValue(clamp(c[3],0,50))
+        top = int(self.cfg.get("maxPerCh",50))     # firmware's per-channel ceiling
+        for sb in (self.c0,self.c1,self.c2,self.c3): sb.setMaximum(top)
+        self.c0.setValue(clamp(c[0],0,top))
+        self.c1.setValue(clamp(c[1],0,top))
+        self.c2.setValue(clamp(c[2],0,top))
+        self.c3.setValue(clamp(c[3],0,top))
 
         # reverse flags (fallback to defaults if missing)
         rev = self.cfg.get("reverse", default_cfg()["reverse"])
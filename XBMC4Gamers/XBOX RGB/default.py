@@ -3,7 +3,7 @@
 # Place at: Q:\system\scripts\XBOX RGB\default.py
 from __future__ import print_function
 
-import socket, time
+import socket, time, copy
 try:
     import json as _json
 except Exception:
@@ -25,6 +25,7 @@ MODES = [
     (8, 'Meteor'), (9, 'Clock Spin'), (10, 'Plasma'), (11, 'Fire / Flicker'),
     (12, 'Palette Cycle'), (13, 'Palette Chase'),
     (14, 'Custom (Playlist)'),
+    (15, 'Temp Reactive'), (16, 'Fan Reactive'),
 ]
 MODE_VALUES = [v for v,_ in MODES]
 MODE_NAMES  = [n for _,n in MODES]
@@ -111,6 +112,9 @@ def dlg_numeric(n_type, heading, default_text=''):
 class UdpClient(object):
     def __init__(self, psk=''):
         self.psk = psk or ''
+        self.gen = 0          # config generation from the last get/patch reply
+        self.sent = None      # device config as of self.gen (None = unknown)
+        self.can_patch = True
 
     def _bind_sock(self):
         s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
@@ -200,11 +204,33 @@ class UdpClient(object):
     def get(self, ip, port):
         r = self._send_recv(ip, port, {'op':'get'})
         if not r: return None
-        return r.get('cfg') if isinstance(r, dict) and 'cfg' in r else r
-
-    # preview/save: do NOT wait for a reply (firmware typically sends none)
-    def preview(self, ip, port, cfg): return self._send_only(ip, port, {'op':'preview','cfg':cfg})
-    def save(self, ip, port, cfg):    return self._send_only(ip, port, {'op':'save','cfg':cfg})
+        c = r.get('cfg') if isinstance(r, dict) and 'cfg' in r else r
+        if isinstance(r, dict) and isinstance(c, dict) and r.get('gen'):
+            self.gen, self.sent = int(r['gen']), copy.deepcopy(c)
+        return c
+
+    # preview sends only the fields that changed ("patch", firmware 1.7.0+),
+    # falling back to the full config; save replies aren't waited for.
+    def preview(self, ip, port, cfg):
+        if self.can_patch and self.sent is not None:
+            delta = dict((k, v) for k, v in cfg.items() if self.sent.get(k) != v)
+            if not delta: return True
+            r = self._send_recv(ip, port, {'op':'patch','gen':self.gen,'cfg':delta}, timeout=0.6)
+            if isinstance(r, dict) and r.get('err') == 'stale':
+                delta = cfg                   # someone else changed it: resend everything
+                r = self._send_recv(ip, port, {'op':'patch','gen':int(r.get('gen') or 0),'cfg':delta}, timeout=0.6)
+            if isinstance(r, dict) and r.get('ok'):
+                self.gen = int(r.get('gen') or 0)
+                self.sent.update(copy.deepcopy(delta))
+                return True
+            if isinstance(r, dict): self.can_patch = False   # older firmware
+        return self._send_full(ip, port, 'preview', cfg)
+    def save(self, ip, port, cfg): return self._send_full(ip, port, 'save', cfg)
+
+    def _send_full(self, ip, port, op, cfg):
+        # generation unknown afterwards: next patch is unconditional (gen 0)
+        self.sent, self.gen = copy.deepcopy(cfg), 0
+        return self._send_only(ip, port, {'op':op,'cfg':cfg})
     def reset(self, ip, port):        r=self._send_recv(ip, port, {'op':'reset'}); return bool(r and r.get('ok'))
 
     # json helpers kept inside the class to avoid name clashes
@@ -359,12 +385,13 @@ class App(object):
     def set_counts(self):
         counts = list(self.cfg.get('count') or [0,0,0,0]) + [0,0,0,0]
         labels = ['CH1 Count','CH2 Count','CH3 Count','CH4 Count']
+        top = int(self.cfg.get('maxPerCh') or 50)
         for i in range(4):
             cur = int(counts[i])
-            val = dlg_numeric(0, '%s (0-50)' % labels[i], str(cur))
+            val = dlg_numeric(0, '%s (0-%d)' % (labels[i], top), str(cur))
             try:
                 if val not in (None, ''):
-                    counts[i] = max(0, min(50, int(val)))
+                    counts[i] = max(0, min(top, int(val)))
             except Exception:
                 pass
         self.cfg['count'] = counts[:4]
@@ -1,24 +1,108 @@
 #include "RGBCtrl.h"
 #include "RGBudp.h"
+#include "RGBout.h"
+#include "RGBsmbus.h"
+#include "RGBstats.h"
+#include "web_config.h"   // gzip'd UI page (tools/webgz.py)
 #include <Preferences.h>
 #include <ArduinoJson.h>
 #include <Adafruit_NeoPixel.h>
 #include <ESPAsyncWebServer.h>
 #include <math.h>
 #include <esp_system.h>  // esp_random
-#include <vector>
+#include <esp_timer.h>   // 64-bit µs clock for multi-unit sync
+#include <atomic>
 
 // Use the existing WiFiMgr server; no separate server objects needed.
-namespace WiFiMgr { AsyncWebServer& getServer(); }
+namespace WiFiMgr {
+  AsyncWebServer& getServer();
+  void sendGzPage(AsyncWebServerRequest* req, const uint8_t* gz, size_t len, const String& etag);
+}
 
 // -------------------- Build / Branding --------------------
-static const char* APP_VERSION = "1.6.1"; // shown in footer
+static const char* APP_VERSION = "1.7.0"; // shown in footer
 static const char* COPYRIGHT_TXT = "© Darkone Customs 2025";
 
+// Drive CH1..CH4 through the async RMT backend (RGBout) when channels are free.
+#ifndef RGBCTRL_ASYNC_OUT
+#define RGBCTRL_ASYNC_OUT 1
+#endif
+
+// Render on a dedicated FreeRTOS task instead of from loop(). The task runs on
+// the core that is NOT running the Arduino loop (UDP/SMBus/WiFiMgr stay there).
+#ifndef RGBCTRL_RENDER_TASK
+#define RGBCTRL_RENDER_TASK 0
+#endif
+#ifndef RGBCTRL_RENDER_CORE
+  #if CONFIG_FREERTOS_UNICORE
+    #define RGBCTRL_RENDER_CORE 0
+  #else
+    #define RGBCTRL_RENDER_CORE (ARDUINO_RUNNING_CORE ? 0 : 1)
+  #endif
+#endif
+#ifndef RGBCTRL_RENDER_PRIO
+#define RGBCTRL_RENDER_PRIO 3        // above loop() (1), below the WiFi/lwIP tasks
+#endif
+#ifndef RGBCTRL_RENDER_STACK
+#define RGBCTRL_RENDER_STACK 6144
+#endif
+
+// Realtime stream (DDP via RGBudp): fall back to the animation after this
+// long without a pushed frame.
+#ifndef RGBCTRL_STREAM_TIMEOUT_MS
+#define RGBCTRL_STREAM_TIMEOUT_MS 2500
+#endif
+
+// NVS write-behind: a save request waits this long for more changes before
+// it is written; a steady stream of requests is still flushed after
+// RGBCTRL_SAVE_MAX_DELAY_MS.
+#ifndef RGBCTRL_SAVE_DEBOUNCE_MS
+#define RGBCTRL_SAVE_DEBOUNCE_MS 1500
+#endif
+#ifndef RGBCTRL_SAVE_MAX_DELAY_MS
+#define RGBCTRL_SAVE_MAX_DELAY_MS 8000
+#endif
+
+// Live-control WebSocket: config change pushes to clients are coalesced to
+// at most one per this many ms.
+#ifndef RGBCTRL_WS_NOTIFY_MS
+#define RGBCTRL_WS_NOTIFY_MS 150
+#endif
+
+// Frame rate cap while an OTA update is being written (progress bar only).
+#ifndef RGBCTRL_OTA_FPS
+#define RGBCTRL_OTA_FPS 20
+#endif
+
+// Reactive modes: CPU temperature mapped Color A -> Color B across this range.
+#ifndef RGBCTRL_REACT_CPU_LO_C
+#define RGBCTRL_REACT_CPU_LO_C 30
+#endif
+#ifndef RGBCTRL_REACT_CPU_HI_C
+#define RGBCTRL_REACT_CPU_HI_C 75
+#endif
+
+// Colour/trig kernels: 0 = fixed-point + lookup tables (default),
+// 1 = the original float math (sinf/hsv2rgb/lerp), for A/B comparison.
+#ifndef RGBCTRL_FLOAT_KERNELS
+#define RGBCTRL_FLOAT_KERNELS 0
+#endif
+
+// Per-channel LED ceiling. Buffers are sized to the configured counts, not
+// to this; counts the heap can't hold (keeping RGBCTRL_HEAP_RESERVE free for
+// WiFi, the web server and OTA) are trimmed when they are set.
+#ifndef RGBCTRL_MAX_PER_CH
+#define RGBCTRL_MAX_PER_CH 300
+#endif
+#ifndef RGBCTRL_HEAP_RESERVE
+#define RGBCTRL_HEAP_RESERVE 32768
+#endif
+
 // -------------------- Limits / Types --------------------
-static const uint16_t MAX_PER_CH = 50;        // per requirement
+static const uint16_t MAX_PER_CH = RGBCTRL_MAX_PER_CH;
 static const uint8_t  NUM_CH     = 4;         // CH1..CH4 only
-static const uint16_t MAX_RING   = MAX_PER_CH * NUM_CH; // 200
+static const uint8_t  FPS_MIN    = 10;
+static const uint8_t  FPS_MAX    = 120;
 
 namespace RGBCtrl {
 
@@ -48,6 +132,49 @@ static Adafruit_NeoPixel* STRIPS[NUM_CH] = { &strip1, &strip2, &strip3, &strip4
 static Preferences prefs;
 static String gBase = "/config";  // mount path
 
+// ---- Compiled playlist ----
+// customSeq (JSON) is compiled into this table whenever it is set, so the
+// renderer never parses JSON or compares strings. Override flags say which
+// base parameters a step replaces for its duration.
+static const uint8_t MAX_STEPS = 32;
+enum : uint8_t {
+  STEP_SPEED = 0x01, STEP_INTENSITY = 0x02, STEP_WIDTH = 0x04, STEP_PCNT = 0x08,
+  STEP_A     = 0x10, STEP_B         = 0x20, STEP_C     = 0x40, STEP_D    = 0x80
+};
+static const uint16_t STEP_XF_DEFAULT = 0xFFFF;   // step uses the global transition
+static const uint16_t XF_MAX_MS       = 10000;
+struct PlayStep {
+  uint8_t  mode;
+  uint8_t  has;          // STEP_* override flags
+  uint16_t duration;     // ms
+  uint16_t transition;   // crossfade into this step, ms (or STEP_XF_DEFAULT)
+  uint8_t  speed, intensity, width, pcount;
+  uint32_t colorA, colorB, colorC, colorD;
+};
+struct Playlist {
+  uint8_t  n;
+  PlayStep step[MAX_STEPS];
+};
+
+// ---- Compiled zones ----
+// zones (JSON, same step format as customSeq plus "ch" and "fps") split the
+// ring into parts that run their own effect. Pixels no zone claims keep the
+// base effect (mode / playlist), so an empty table is the plain whole ring.
+static const uint8_t  MAX_ZONES  = 4;
+static const uint8_t  ZONE_SPANS = 4;        // channel ranges per zone
+static const uint16_t SPAN_TO_END = 0xFFFF;  // range runs to the end of the channel
+struct ZoneSpan { uint8_t ch; uint16_t start, len; };
+struct ZoneDef {
+  PlayStep p;            // mode + overrides (duration/transition unused)
+  uint8_t  fps;          // 0 = the global frame rate
+  uint8_t  nSpan;
+  ZoneSpan span[ZONE_SPANS];
+};
+struct ZoneTable {
+  uint8_t n;
+  ZoneDef z[MAX_ZONES];
+};
+
 // ---- Config ----
 struct AppConfig {
   uint16_t count[NUM_CH] = {50,50,50,50};
@@ -56,6 +183,8 @@ struct AppConfig {
   uint8_t  speed         = 128;  // 0..255 (higher=faster)
   uint8_t  intensity     = 128;  // meaning depends on mode
   uint8_t  width         = 4;    // “segment width” / “gap”
+  uint8_t  fps           = 60;   // fixed render rate (FPS_MIN..FPS_MAX)
+  uint16_t transition    = 400;  // crossfade on mode/step change, ms (0 = cut)
 
   // --- Colors / Palette ---
   uint32_t colorA        = 0xFF0000; // #RRGGBB
@@ -81,10 +210,89 @@ struct AppConfig {
   // JSON string of steps; see Custom editor in WebUI for example.
   String   customSeq     = "[]";
   bool     customLoop    = true;
+  Playlist steps         = {};        // customSeq, compiled
+
+  // Zones: JSON string of zone objects (see compileZones)
+  String    zoneSpec     = "[]";
+  ZoneTable zones        = {};        // zoneSpec, compiled
 } CFG;
 
 static bool inPreview = false;
 
+// ---- Render-side config snapshot ----
+// The renderer never reads CFG. Writers (web, UDP, loop) publish a POD copy
+// into a double buffer guarded by a sequence counter; the renderer copies the
+// front buffer into RS at the start of a frame without taking a lock.
+struct RenderCfg {
+  uint16_t count[NUM_CH];
+  uint8_t  brightness, mode, speed, intensity, width, paletteCount, fps;
+  uint16_t transition;
+  uint32_t colorA, colorB, colorC, colorD;
+  bool     reverse[NUM_CH];
+  bool     masterOff, customLoop;
+  uint32_t seqGen;               // bumps whenever the compiled playlist changes
+  uint32_t zoneGen;              // ... and the zone table
+};
+static RenderCfg RS;             // render-owned working copy
+
+static RenderCfg             snapBuf[2];
+static std::atomic<uint8_t>  snapFront{0};
+static std::atomic<uint32_t> snapSeq{0};   // odd while a writer is mid-update
+static uint32_t              rsSeq = 0xFFFFFFFF;
+static SemaphoreHandle_t     snapMutex = nullptr;   // serializes writers
+
+// The step table is too big to copy every publish, so it is handed over
+// separately and the renderer only copies it when seqGen moves.
+static Playlist  seqShared  = {};
+static uint32_t  seqGen     = 0;
+static ZoneTable zoneShared = {};
+static uint32_t  zoneGen    = 0;
+
+static void renderCfgFrom(const AppConfig& c, RenderCfg& r) {
+  for (uint8_t i=0;i<NUM_CH;++i) { r.count[i] = c.count[i]; r.reverse[i] = c.reverse[i]; }
+  r.brightness   = c.brightness;
+  r.mode         = c.mode;
+  r.speed        = c.speed;
+  r.intensity    = c.intensity;
+  r.width        = c.width;
+  r.paletteCount = c.paletteCount;
+  r.fps          = c.fps;
+  r.transition   = c.transition;
+  r.colorA = c.colorA; r.colorB = c.colorB; r.colorC = c.colorC; r.colorD = c.colorD;
+  r.masterOff    = c.masterOff;
+  r.customLoop   = c.customLoop;
+}
+
+static void publishConfig() {
+  if (snapMutex) xSemaphoreTake(snapMutex, portMAX_DELAY);
+  if (memcmp(&seqShared, &CFG.steps, sizeof(Playlist))) { seqShared = CFG.steps; ++seqGen; }
+  if (memcmp(&zoneShared, &CFG.zones, sizeof(ZoneTable))) { zoneShared = CFG.zones; ++zoneGen; }
+
+  snapSeq.fetch_add(1);
+  RenderCfg& r = snapBuf[snapFront.load() ^ 1];
+  renderCfgFrom(CFG, r);
+  r.seqGen       = seqGen;
+  r.zoneGen      = zoneGen;
+  snapFront.store(snapFront.load() ^ 1);
+  snapSeq.fetch_add(1);
+
+  if (snapMutex) xSemaphoreGive(snapMutex);
+}
+
+// Renderer side: copy the step table published with RS.seqGen.
+static void takePlaylist(Playlist& out) {
+  if (snapMutex) xSemaphoreTake(snapMutex, portMAX_DELAY);
+  out = seqShared;
+  if (snapMutex) xSemaphoreGive(snapMutex);
+}
+
+// Renderer side: copy the zone table published with RS.zoneGen.
+static void takeZones(ZoneTable& out) {
+  if (snapMutex) xSemaphoreTake(snapMutex, portMAX_DELAY);
+  out = zoneShared;
+  if (snapMutex) xSemaphoreGive(snapMutex);
+}
+
 enum : uint8_t {
   MODE_SOLID = 0,
   MODE_BREATHE,
@@ -106,18 +314,178 @@ enum : uint8_t {
   // --- NEW: user-defined playlist mode ---
   MODE_CUSTOM,
 
+  // sensor-reactive modes (RGBsmbus SMC cache):
+  MODE_TEMP_REACT,      // ring colour follows CPU temperature
+  MODE_FAN_REACT,       // blades spin with the fan
+
   MODE_COUNT
 };
 
 struct Seg { uint8_t ch; uint16_t count; };
 static Seg segs[NUM_CH];
-static uint32_t msPrev = 0;
-static uint16_t tick   = 0;
+// ---- Animation clock ----
+// Frames run at a fixed RS.fps; motion is driven by elapsed time. The clock
+// counts "ticks" at the legacy speed-derived rate (one tick per
+// legacyFrameMs(speed)), so speed shapes the motion exactly as before while
+// the frame rate stays constant. Each effect layer keeps its own clock
+// (FxLayer): tick is the whole part (wraps like before), tickF adds the
+// fraction, frameTicks is how far this frame advanced.
+static uint32_t nextFrameUs = 0;
+static uint32_t lastFrameUs = 0;
+static float    frameDtMs   = 0.f;   // real time since the previous frame
+
+// Multi-unit sync (driven by RGBCtrlUDP). While on, layer clocks are derived
+// from a shared "show clock" (esp_timer + offset) instead of accumulating,
+// so units with the same settings land on the same tick; followers also
+// take the leader's playlist step. Random effects (twinkle, fire...) still
+// differ per unit.
+static portMUX_TYPE      syncMux      = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool     syncOn       = false;
+static int64_t           syncOffsetUs = 0;
+struct SyncStepReq { uint32_t crc; uint8_t idx; uint32_t stepMs; uint32_t rxMs; };
+static SyncStepReq       syncStep;
+static volatile bool     syncStepPending = false;
+
+static int64_t showClockUs() {
+  portENTER_CRITICAL(&syncMux);
+  const int64_t off = syncOffsetUs;
+  portEXIT_CRITICAL(&syncMux);
+  return esp_timer_get_time() + off;
+}
+
+// Ring framebuffers: animations write into their layer buffer in ring order
+// (see FxLayer), fb[] holds crossfade output, and blitRing() pushes the
+// final frame to the strips. ringMap[] resolves ring index -> (strip, pixel)
+// with RS.reverse already folded in, so per-pixel writes are a single store.
+// Channels are unscaled 8.8 fixed point so trails can fade below one LSB
+// without quantizing; brightness is applied only at blit time.
+// fb[], ringMap[] and the layer buffers live in the pixel pool (see poolFit).
+struct Rgb16 { uint16_t R, G, B; };
+struct PixMap { uint8_t strip; uint16_t px; };
+static Rgb16*   fb      = nullptr;
+static PixMap*  ringMap = nullptr;
+static uint8_t* owner   = nullptr;   // ring index -> zone+1, 0 = base effect
+static uint16_t ringCount = 0;   // valid entries in the ring buffers / ringMap[]
+
+static inline uint8_t legacyFrameMs(uint8_t speed) {
+  return 10 + (uint8_t)((255 - speed)/2); // faster speed -> shorter tick
+}
+
+// ---- Effect instances ----
+// A running effect owns its parameters, its animation clock and state, and a
+// layer buffer, so two instances can run side by side while the compositor
+// crossfades between them. Animations draw into FX->buf using FX->p.
+static const uint8_t METEOR_MAX = 8;
+struct FxState {
+  float    breathePhase, breatheLvl;
+  uint16_t* twinkle;                // per-pixel glint phase (8.8), 0 = idle (pool)
+  float    spawnAcc;
+  bool     meteorInit;
+  float    mPos[METEOR_MAX], mVel[METEOR_MAX];
+  uint8_t  mLen[METEOR_MAX];
+  uint16_t mLastL;
+  float    plasmaT;
+  uint8_t*  heat;                   // fire heat map (pool)
+  uint16_t lastFireTick;
+  float    reactLvl, reactPhase;    // reactive modes: eased sensor level, motion
+  uint32_t rng;                     // xorshift32 state (see fxRand)
+};
+struct FxLayer {
+  uint8_t   mode;
+  RenderCfg p;                      // parameters (base or playlist step overlay)
+  uint16_t  tick;                   // animation clock in legacy ticks of p.speed
+  float     tickFrac, tickF, frameTicks;
+  FxState   st;
+  Rgb16*    buf;                    // pool
+  uint16_t  cap;                    // pixels buf/twinkle/heat hold
+};
+static FxLayer  layers[2];
+static uint8_t  curLayer = 0;            // incoming / only layer
+static FxLayer* FX = &layers[0];         // instance being rendered
+
+// ---- Pixel pool ----
+// One block holds everything sized by the ring: fb[], ringMap[], both
+// layers' buffer, glint phases and heat map, and the zone owner map. The
+// renderer refits it when the counts change (rebuildRingMap), so memory
+// follows the installed LEDs and nothing is allocated per frame. If the
+// heap can't take a bigger pool the old one is kept and the ring is cut
+// short (poolShort) until it can.
+static const size_t LAYER_PX_BYTES = sizeof(Rgb16) + sizeof(uint16_t) + sizeof(uint8_t);
+static const size_t POOL_PX_BYTES  = sizeof(Rgb16) + sizeof(PixMap) + 2 * LAYER_PX_BYTES + 1;
+// Heap per LED counted against RGBCTRL_HEAP_RESERVE: the pool, a zone layer,
+// the stream buffers, the strip's own pixels and (async output) 24 RMT symbols.
+static const size_t LED_HEAP_BYTES = POOL_PX_BYTES + LAYER_PX_BYTES + 2 * sizeof(Rgb16) + 3 +
+                                     (RGBCTRL_ASYNC_OUT ? 24 * 4 : 0);
+static uint8_t*  poolMem   = nullptr;
+static uint16_t  poolCap   = 0;
+static bool      poolShort = false;      // counts exceed what the pool holds
+static uint32_t  poolFits  = 0;          // reallocations since boot
+
+static inline size_t layerBytes(uint16_t n) { return ((size_t)n * LAYER_PX_BYTES + 3) & ~(size_t)3; }
+
+// Point a layer at n pixels of memory at p (zeroed by the caller).
+static void layerBind(FxLayer& L, uint8_t* p, uint16_t n) {
+  L.buf        = (Rgb16*)p;     p += (size_t)n * sizeof(Rgb16);
+  L.st.twinkle = (uint16_t*)p;  p += (size_t)n * sizeof(uint16_t);
+  L.st.heat    = p;
+  L.cap        = n;
+}
+
+static bool poolFit(uint16_t n) {
+  if (poolMem && n == poolCap) return true;
+  const size_t ring = (size_t)n * (sizeof(Rgb16) + sizeof(PixMap));
+  const size_t len  = ring + 2 * layerBytes(n) + n;
+  uint8_t* m = (uint8_t*)malloc(len ? len : 4);
+  if (!m) return false;
+  memset(m, 0, len);
+  free(poolMem);
+  poolMem = m; poolCap = n; ++poolFits;
+  fb      = (Rgb16*)m;
+  ringMap = (PixMap*)(m + (size_t)n * sizeof(Rgb16));
+  layerBind(layers[0], m + ring, n);
+  layerBind(layers[1], m + ring + layerBytes(n), n);
+  owner   = m + ring + 2 * layerBytes(n);
+  return true;
+}
 
-// Fire state (max ring length)
-static uint8_t heat[MAX_RING]; // 0..255 heat map
+// Whole-ring LEDs the heap can hold: what the pool has now plus the free heap
+// above RGBCTRL_HEAP_RESERVE. Read from any context (poolCap is one word).
+static uint16_t ringLimit() {
+  const uint32_t freeB = ESP.getFreeHeap();
+  const uint32_t spare = freeB > RGBCTRL_HEAP_RESERVE ? freeB - RGBCTRL_HEAP_RESERVE : 0;
+  const uint32_t lim   = (uint32_t)poolCap + spare / LED_HEAP_BYTES;
+  return lim > (uint32_t)MAX_PER_CH * NUM_CH ? MAX_PER_CH * NUM_CH : (uint16_t)lim;
+}
+
+// Trim counts (CH4 first) so the ring fits ringLimit().
+static void fitCounts(uint16_t* count) {
+  uint32_t total = 0;
+  for (uint8_t c=0; c<NUM_CH; ++c) total += count[c];
+  if (total <= poolCap) return;            // shrinking or unchanged: always fits
+  const uint16_t lim = ringLimit();
+  if (total <= lim) return;
+  for (int8_t c=NUM_CH-1; c>=0 && total>lim; --c) {
+    const uint32_t cut = count[c] < total - lim ? count[c] : total - lim;
+    count[c] -= (uint16_t)cut; total -= cut;
+  }
+  Serial.printf("[RGBCtrl] counts trimmed to %u LEDs (heap)\n", (unsigned)lim);
+}
+
+// Per-instance PRNG for the random effects. Seeded from the hardware RNG in
+// fxReset(); the benchmark seeds it fixed so frames are reproducible.
+static inline uint32_t fxRand() {
+  uint32_t x = FX->st.rng;
+  x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+  return FX->st.rng = x;
+}
+
+// Crossfade state (outgoing layer = curLayer ^ 1)
+static bool     xfActive  = false;
+static uint32_t xfStartMs = 0;
+static uint16_t xfDurMs   = 0;
 
-// track last applied brightness
+// Output brightness used by the last blit (global brightness or boot-fade ramp).
+// The strips themselves stay at full scale; see blitRing().
 static uint8_t lastAppliedBrightness = 0xFF;
 
 // --- Boot fade-in state ---
@@ -130,82 +498,280 @@ static uint8_t  bootFadeTarget      = 0;
 inline RgbColor rgbFrom24(uint32_t rgb) {
   return RgbColor((rgb>>16)&0xFF, (rgb>>8)&0xFF, rgb&0xFF);
 }
-static inline RgbColor unpackGRB(uint32_t c) {
-  // Adafruit_NeoPixel packs as 0x00GGRRBB for NEO_GRB
-  uint8_t g = (c >> 16) & 0xFF;
-  uint8_t r = (c >>  8) & 0xFF;
-  uint8_t b = (c      ) & 0xFF;
-  return RgbColor(r,g,b);
-}
 static inline RgbColor rgbFrom32(uint32_t c) {
   return RgbColor(uint8_t((c>>16)&0xFF), uint8_t((c>>8)&0xFF), uint8_t(c&0xFF));
 }
 
+// ---- Zone runtime (render context) ----
+// Each used zone gets a layer sized to its pixels (one more block, refit
+// with the ring map). spans[] covers the ring in order, each run taken from
+// the base frame or a zone layer, so blitting a zoned frame is still one
+// pass. A zone renders at its own rate; a solid one only when its
+// parameters change. Zones that didn't render aren't blitted, and strips
+// nothing new was blitted to skip show().
+struct ZoneRun {
+  FxLayer  L;
+  uint16_t len;                 // pixels (ring order, overlaps go to the first zone)
+  uint32_t lastUs, nextUs;      // last render / next one due
+  uint32_t rsSeen;              // rsSeq at the last render
+  bool     drawn, dirty;        // rendered since the reset / this frame
+  uint32_t renders, skips;
+};
+struct Span { uint16_t at, len, off; uint8_t zone; };   // zone 0 = base
+static const uint8_t MAX_SPANS = 2 * MAX_ZONES * ZONE_SPANS + 1;
+static ZoneTable zt      = {};          // renderer copy of the table
+static ZoneRun   zr[MAX_ZONES];
+static uint8_t   nZones  = 0;            // zones in use, 0 = whole ring
+static uint8_t*  zoneMem = nullptr;
+static Span      spans[MAX_SPANS];
+static uint8_t   nSpans  = 0;
+static uint16_t  basePx  = 0;            // pixels left to the base effect
+static bool      zoneBlitAll = true;     // next zoned blit redraws every span
+static bool      zoneShort   = false;    // table dropped: no memory for it
+
+static void rebuildZones() {
+  nZones = 0; nSpans = 0; basePx = ringCount; zoneBlitAll = true;
+  free(zoneMem); zoneMem = nullptr;
+  if (!zt.n || !ringCount) { zoneShort = false; return; }
+
+  uint16_t chStart[NUM_CH], at = 0;
+  for (uint8_t c=0; c<NUM_CH; ++c) { chStart[c] = at; at += RS.count[c]; }
+  memset(owner, 0, ringCount);
+  for (uint8_t z=0; z<zt.n; ++z) {
+    for (uint8_t k=0; k<zt.z[z].nSpan; ++k) {
+      const ZoneSpan& sp = zt.z[z].span[k];
+      if (sp.ch >= NUM_CH) continue;
+      const uint16_t cnt = RS.count[sp.ch];
+      if (sp.start >= cnt) continue;
+      const uint16_t len = (sp.len > cnt - sp.start) ? cnt - sp.start : sp.len;
+      for (uint16_t i=0; i<len; ++i) {
+        const uint16_t idx = chStart[sp.ch] + sp.start + i;
+        if (idx < ringCount && !owner[idx]) owner[idx] = z + 1;
+      }
+    }
+  }
+
+  size_t bytes = 0;
+  for (uint8_t z=0; z<zt.n; ++z) zr[z].len = 0;
+  for (uint16_t i=0; i<ringCount; ++i) if (owner[i]) ++zr[owner[i]-1].len;
+  for (uint8_t z=0; z<zt.n; ++z) bytes += layerBytes(zr[z].len);
+  zoneMem = (uint8_t*)calloc(bytes ? bytes : 4, 1);
+  zoneShort = !zoneMem;
+  if (!zoneMem) return;                  // whole ring until the table changes
+
+  uint8_t* p = zoneMem;
+  for (uint8_t z=0; z<zt.n; ++z) {
+    ZoneRun& r = zr[z];
+    const uint16_t len = r.len;
+    memset(&r, 0, sizeof(r));
+    layerBind(r.L, p, len);
+    r.len = len;
+    p += layerBytes(len);
+  }
+  nZones = zt.n;
+
+  uint16_t off[MAX_ZONES + 1] = {};
+  basePx = 0;
+  for (uint16_t i=0; i<ringCount; ) {
+    const uint8_t z = owner[i];
+    uint16_t j = i + 1;
+    while (j < ringCount && owner[j] == z) ++j;
+    if (nSpans >= MAX_SPANS) { nZones = 0; nSpans = 0; basePx = ringCount; return; }
+    spans[nSpans++] = Span{ i, (uint16_t)(j - i), off[z], z };
+    off[z] += j - i;
+    if (!z) basePx += j - i;
+    i = j;
+  }
+}
+
+// Pixels the effects draw: the configured ring, or what the pool holds.
 static uint16_t ringLen() {
-  return CFG.count[0] + CFG.count[1] + CFG.count[2] + CFG.count[3];
+  return ringCount;
 }
 static void rebuildRingMap() {
   // Strict order CH1 -> CH2 -> CH3 -> CH4 (Front -> Left -> Rear -> Right)
-  segs[0] = {0, CFG.count[0]};
-  segs[1] = {1, CFG.count[1]};
-  segs[2] = {2, CFG.count[2]};
-  segs[3] = {3, CFG.count[3]};
-}
-static void setRing(uint16_t idx, const RgbColor& c) {
-  uint16_t base = 0;
+  segs[0] = {0, RS.count[0]};
+  segs[1] = {1, RS.count[1]};
+  segs[2] = {2, RS.count[2]};
+  segs[3] = {3, RS.count[3]};
+
+  // Strips hold exactly their count (the RMT buffer follows in RGBout::show).
+  for (uint8_t c=0; c<NUM_CH; ++c)
+    if (STRIPS[c]->numPixels() != RS.count[c]) STRIPS[c]->updateLength(RS.count[c]);
+
+  const uint16_t want = RS.count[0] + RS.count[1] + RS.count[2] + RS.count[3];
+  poolShort = !poolFit(want);
+
+  uint16_t idx = 0;
   for (uint8_t s=0; s<NUM_CH; ++s) {
-    if (idx < base + segs[s].count) {
-      uint16_t within = idx - base;
-      bool rev = CFG.reverse[segs[s].ch] && segs[s].count;
-      uint16_t px = rev ? (segs[s].count - 1 - within) : within;
-      STRIPS[segs[s].ch]->setPixelColor(px, c.R, c.G, c.B);
-      return;
+    const uint16_t n = segs[s].count;
+    const bool rev = RS.reverse[segs[s].ch];
+    for (uint16_t within=0; within<n && idx<poolCap; ++within, ++idx) {
+      ringMap[idx].strip = segs[s].ch;
+      ringMap[idx].px    = rev ? (n - 1 - within) : within;
     }
-    base += segs[s].count;
   }
+  ringCount = idx;
+  rebuildZones();
+}
+// Pull the latest published config into RS. Returns true if it changed.
+static bool syncSnapshot() {
+  const uint32_t s0 = snapSeq.load();
+  if (s0 == rsSeq) return false;
+  // Writers only touch the back buffer; a matching counter around the copy
+  // means the front buffer did not flip (or get rewritten) underneath us.
+  for (uint8_t tries=0; tries<4; ++tries) {
+    const uint32_t s1 = snapSeq.load();
+    RenderCfg tmp = snapBuf[snapFront.load()];
+    if (snapSeq.load() != s1) continue;
+    const bool mapChanged = memcmp(tmp.count, RS.count, sizeof(RS.count)) ||
+                            memcmp(tmp.reverse, RS.reverse, sizeof(RS.reverse));
+    const bool zonesChanged = tmp.zoneGen != RS.zoneGen;
+    RS = tmp;
+    rsSeq = s1;
+    if (zonesChanged) takeZones(zt);
+    if (mapChanged) rebuildRingMap();
+    else if (zonesChanged) rebuildZones();
+    return true;
+  }
+  return false;   // writer busy; keep last snapshot for this frame
 }
-static void fillRing(const RgbColor& c) {
-  uint16_t L = ringLen();
-  for (uint16_t i=0; i<L; ++i) setRing(i, c);
+
+static inline Rgb16 to16(const RgbColor& c) {
+  // 8-bit -> 8.8 with full-scale 255 mapping to 0xFFFF
+  return Rgb16{ (uint16_t)(c.R * 257u), (uint16_t)(c.G * 257u), (uint16_t)(c.B * 257u) };
+}
+static inline void setRing(uint16_t idx, const RgbColor& c) {
+  if (idx < ringCount) FX->buf[idx] = to16(c);
 }
+static void fillRing(const RgbColor& c) {
+  const Rgb16 v = to16(c);
+  for (uint16_t i=0; i<ringCount; ++i) FX->buf[i] = v;
+}
+// amt is the per-tick fade (as tuned at the legacy frame rate); it is
+// compounded over frameTicks so trails decay at the same speed at any FPS.
+// keep is a 0.16 fraction: at 1/256 a small fade at high FPS rounds to
+// "keep everything" and the trail never goes out. Flooring the product
+// takes at least one unit off every lit channel, so trails always reach 0.
 static void fadeRing(uint8_t amt) {
-  for (uint8_t s = 0; s < NUM_CH; ++s) {
-    for (uint16_t i = 0; i < segs[s].count; ++i) {
-      uint32_t packed = STRIPS[segs[s].ch]->getPixelColor(i); // get packed GRB
-      RgbColor c = unpackGRB(packed);                         // unpack to RGB
-      uint8_t r = (uint16_t)c.R * (255 - amt) >> 8;
-      uint8_t g = (uint16_t)c.G * (255 - amt) >> 8;
-      uint8_t b = (uint16_t)c.B * (255 - amt) >> 8;
-      STRIPS[segs[s].ch]->setPixelColor(i, r, g, b);
+  if (FX->frameTicks <= 0.f) return;
+  const float    k    = powf((255 - amt) / 256.0f, FX->frameTicks);
+  const uint32_t k16  = (uint32_t)(k * 65536.0f + 0.5f);
+  const uint32_t keep = k16 > 65535u ? 65535u : k16;
+  Rgb16* b = FX->buf;
+  for (uint16_t i=0; i<ringCount; ++i) {
+    b[i].R = (uint16_t)(((uint32_t)b[i].R * keep) >> 16);
+    b[i].G = (uint16_t)(((uint32_t)b[i].G * keep) >> 16);
+    b[i].B = (uint16_t)(((uint32_t)b[i].B * keep) >> 16);
+  }
+}
+
+// Since-boot distributions for /api/stats (PerfStat is the live view).
+static RGBstats::Hist statFrame;             // whole renderFrame()
+static RGBstats::Hist statJitter;            // frame start lateness vs its slot
+static RGBstats::Hist statNvs;               // one NVS save (flash write)
+static RGBstats::Acc  statMode[MODE_COUNT];  // one effect layer, by mode
+static RGBstats::Acc  statShow[NUM_CH];      // show() per channel
+static uint32_t statFpsWinUs = 0, statFpsFrames = 0, statFpsX10 = 0;
+
+// On-device benchmark (benchStep): requested from any context, run by the
+// renderer. Per-mode stats are not updated while it runs.
+enum : uint8_t { BENCH_IDLE, BENCH_REQ, BENCH_RUN, BENCH_DONE };
+static volatile uint8_t  benchState  = BENCH_IDLE;
+static volatile uint16_t benchFrames = 0;
+static String            benchOut;            // last result (guarded by stageLock)
+
+// Push a frame to the strips (single pass, no segment search), scaling by
+// the output brightness on the way out.
+static void blitRing(const Rgb16* src, uint8_t bri) {
+  const uint32_t scale = (uint32_t)bri + 1;   // 1..256, same curve as NeoPixel
+  for (uint16_t i=0; i<ringCount; ++i) {
+    const PixMap& m = ringMap[i];
+    STRIPS[m.strip]->setPixelColor(m.px,
+      (uint8_t)((src[i].R * scale) >> 16),
+      (uint8_t)((src[i].G * scale) >> 16),
+      (uint8_t)((src[i].B * scale) >> 16));
+  }
+}
+
+// Zoned frame: base runs from src, zone runs from their layers; only zones
+// that rendered (everything when `all`). Returns the strips written (bits).
+static uint8_t blitZoned(const Rgb16* src, uint8_t bri, bool all) {
+  const uint32_t scale = (uint32_t)bri + 1;
+  uint8_t touched = 0;
+  for (uint8_t k=0; k<nSpans; ++k) {
+    const Span& sp = spans[k];
+    const Rgb16* from;
+    if (sp.zone) {
+      const ZoneRun& r = zr[sp.zone - 1];
+      if (!all && !r.dirty) continue;
+      from = r.L.buf + sp.off;
+    } else {
+      if (!src) continue;
+      from = src + sp.at;
+    }
+    for (uint16_t i=0; i<sp.len; ++i) {
+      const PixMap& m = ringMap[sp.at + i];
+      STRIPS[m.strip]->setPixelColor(m.px,
+        (uint8_t)((from[i].R * scale) >> 16),
+        (uint8_t)((from[i].G * scale) >> 16),
+        (uint8_t)((from[i].B * scale) >> 16));
+      touched |= (uint8_t)(1u << m.strip);
     }
   }
+  return touched;
 }
 
-static void showRing() {
+// A strip nothing was blitted to is still handed to RGBout this often, so
+// its periodic refresh keeps working.
+static const uint32_t ZONE_IDLE_SHOW_MS = 1000;
+static uint32_t stripCheckMs[NUM_CH] = {};
+
+// zoned: src is the base effect's frame and zones are composited on top;
+// otherwise src is the whole frame (stream, OTA, master off).
+static void showRing(const Rgb16* src, bool zoned = false) {
   // Boot fade: linearly ramp 0 -> target over bootFadeDurationMs
+  uint8_t cur = RS.brightness;
   if (bootFadeActive) {
-    bootFadeTarget = CFG.brightness;                     // follow live target
+    bootFadeTarget = RS.brightness;                     // follow live target
     uint32_t elapsed = millis() - bootFadeStartMs;
-    uint8_t cur = (elapsed >= bootFadeDurationMs)
-                    ? bootFadeTarget
-                    : (uint8_t)((uint32_t)bootFadeTarget * elapsed / bootFadeDurationMs);
+    cur = (elapsed >= bootFadeDurationMs)
+            ? bootFadeTarget
+            : (uint8_t)((uint32_t)bootFadeTarget * elapsed / bootFadeDurationMs);
 
     // Ensure at least 1 when target>0 so the user sees early glow
     if (bootFadeTarget && cur == 0) cur = 1;
 
-    if (cur != lastAppliedBrightness) {
-      for (uint8_t s=0; s<NUM_CH; ++s) STRIPS[s]->setBrightness(cur);
-      lastAppliedBrightness = cur;
-    }
-    if (elapsed >= bootFadeDurationMs) bootFadeActive = false;
+    if (elapsed >= bootFadeDurationMs) { bootFadeActive = false; RGBstats::bootMark(RGBstats::BOOT_FADE); }
+    if (cur) RGBstats::bootMark(RGBstats::BOOT_LIGHT);
+  }
+  static uint8_t zoneBri = 0;
+  uint8_t touched = 0xFF;
+  if (zoned && nZones) {
+    touched = blitZoned(src, cur, zoneBlitAll || cur != zoneBri);
+    zoneBlitAll = false; zoneBri = cur;
   } else {
-    if (lastAppliedBrightness != CFG.brightness) {
-      for (uint8_t s=0; s<NUM_CH; ++s) STRIPS[s]->setBrightness(CFG.brightness);
-      lastAppliedBrightness = CFG.brightness;
+    blitRing(src, cur);
+    zoneBlitAll = true;                  // zones redraw when they come back
+  }
+  lastAppliedBrightness = cur;
+  RGBsmbus::renderBars(frameDtMs);
+  const uint32_t nowMs = millis();
+
+  // Kick off async channels first so they shift out in parallel with any
+  // strips left on the blocking path. Channels whose output didn't change
+  // since the last frame (solid, settled breathe, master off...) are skipped.
+  // The CH5/CH6 bars go out in the same window.
+  for (uint8_t pass=0; pass<2; ++pass) {
+    for (uint8_t s=0; s<NUM_CH; ++s) {
+      if (RGBout::isAsync(*STRIPS[s]) != (pass == 0)) continue;
+      if (!(touched & (1u << s)) && nowMs - stripCheckMs[s] < ZONE_IDLE_SHOW_MS) continue;
+      stripCheckMs[s] = nowMs;
+      const uint32_t t0 = micros();
+      if (RGBout::showIfChanged(*STRIPS[s])) statShow[s].note(micros() - t0);
     }
+    RGBsmbus::showBars(pass == 0);
   }
-
-  for (uint8_t s=0; s<NUM_CH; ++s) STRIPS[s]->show();
 }
 
 static RgbColor wheel(uint8_t pos) {
@@ -213,7 +779,8 @@ static RgbColor wheel(uint8_t pos) {
   if (pos < 170)  { pos -= 85;  return RgbColor(0, 255 - pos*3, pos*3); }
   pos -= 170;     return RgbColor(pos*3, 0, 255 - pos*3);
 }
-static RgbColor hsv2rgb(float h, float s, float v){
+// ---- Float reference kernels (original math) ----
+static RgbColor hsv2rgbF(float h, float s, float v){
   float r,g,b;
   int i = int(h*6.f);
   float f = h*6.f - i;
@@ -233,7 +800,7 @@ static RgbColor hsv2rgb(float h, float s, float v){
 static inline uint8_t clampPaletteCount(uint8_t n){
   if (n < 1) return 1; if (n > 4) return 4; return n;
 }
-static inline RgbColor lerp(const RgbColor& a, const RgbColor& b, float t){
+static inline RgbColor lerpF(const RgbColor& a, const RgbColor& b, float t){
   if (t < 0.f) t = 0.f; if (t > 1.f) t = 1.f;
   return RgbColor(
     (uint8_t)(a.R + (b.R - a.R)*t),
@@ -241,12 +808,7 @@ static inline RgbColor lerp(const RgbColor& a, const RgbColor& b, float t){
     (uint8_t)(a.B + (b.B - a.B)*t)
   );
 }
-static void loadPalette(uint8_t& n, RgbColor p[4]){
-  n = clampPaletteCount(CFG.paletteCount);
-  uint32_t src[4] = { CFG.colorA, CFG.colorB, CFG.colorC, CFG.colorD };
-  for (uint8_t i=0;i<4;i++) p[i] = rgbFrom32(src[i]);
-}
-static RgbColor samplePalette(float x /*0..1*/, uint8_t n, const RgbColor p[4], uint8_t blend){
+static RgbColor samplePaletteF(float x /*0..1*/, uint8_t n, const RgbColor p[4], uint8_t blend){
   // Hard step vs smooth blend controlled by 'intensity'/blend (0=steps, 255=full)
   if (n == 1) return p[0];
   float fx = fmodf(x, 1.0f); if (fx < 0) fx += 1.0f;
@@ -256,7 +818,127 @@ static RgbColor samplePalette(float x /*0..1*/, uint8_t n, const RgbColor p[4],
   float t = pos - floorf(pos);
   if (blend == 0) return p[i0];
   float bw = (blend / 255.0f); // 0..1
-  return lerp(p[i0], p[i1], t * bw);
+  return lerpF(p[i0], p[i1], t * bw);
+}
+
+// ---- Fixed-point kernels ----
+// Angles and palette positions are "turns16": 65536 = one full turn, so
+// wrapping is free (uint16 overflow). Levels are 0..255, sines are Q15.
+
+// sin(2*pi*i/256) * 32767, i = 0..256 (last entry repeats the first so the
+// interpolation below never needs a wrap check). Lives in flash (.rodata).
+static const int16_t SIN_LUT[257] = {
+       0,    804,   1608,   2410,   3212,   4011,   4808,   5602,   6393,   7179,   7962,   8739,
+    9512,  10278,  11039,  11793,  12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+   18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,  23170,  23731,  24279,  24811,
+   25329,  25832,  26319,  26790,  27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+   30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,  32137,  32285,  32412,  32521,
+   32609,  32678,  32728,  32757,  32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,
+   32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,  30273,  29956,  29621,  29268,
+   28898,  28510,  28105,  27683,  27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+   23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,  18204,  17530,  16846,  16151,
+   15446,  14732,  14010,  13279,  12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,
+    6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,      0,   -804,  -1608,  -2410,
+   -3212,  -4011,  -4808,  -5602,  -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+  -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159,
+  -20787, -21403, -22005, -22594, -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+  -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956, -30273, -30571, -30852, -31113,
+  -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+  -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580,
+  -31356, -31113, -30852, -30571, -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+  -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731, -23170, -22594, -22005, -21403,
+  -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+  -12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,  -6393,  -5602,  -4808,  -4011,
+   -3212,  -2410,  -1608,   -804,      0
+};
+
+// Float turns/radians -> turns16, any magnitude (call per frame, not per pixel).
+static inline uint16_t fracToTurns16(float x) {
+  x -= floorf(x);
+  return (uint16_t)(uint32_t)(x * 65536.0f);
+}
+static inline uint16_t radToTurns16(float rad) {
+  return fracToTurns16(rad * (1.0f / 6.2831853f));
+}
+// Ring position i of L as turns16 (i*65536/L).
+static inline uint16_t ringTurns16(uint16_t i, uint16_t L) {
+  return (uint16_t)(((uint32_t)i << 16) / L);
+}
+
+#if RGBCTRL_FLOAT_KERNELS
+
+static inline int16_t sin16(uint16_t a) {
+  return (int16_t)(sinf(a * (6.2831853f / 65536.0f)) * 32767.0f);
+}
+static inline RgbColor hsv2rgb16(uint16_t h, uint8_t s, uint8_t v) {
+  return hsv2rgbF(h / 65536.0f, s / 255.0f, v / 255.0f);
+}
+static inline RgbColor lerp8(const RgbColor& a, const RgbColor& b, uint8_t t) {
+  return lerpF(a, b, t / 256.0f);
+}
+static inline RgbColor samplePalette16(uint16_t x, uint8_t n, const RgbColor p[4], uint8_t blend) {
+  return samplePaletteF(x / 65536.0f, n, p, blend);
+}
+static inline RgbColor scale8(const RgbColor& c, uint8_t k) {
+  const float f = k / 255.0f;
+  return RgbColor((uint8_t)(c.R * f), (uint8_t)(c.G * f), (uint8_t)(c.B * f));
+}
+
+#else
+
+static inline int16_t sin16(uint16_t a) {
+  const uint8_t  i = a >> 8;
+  const int32_t  f = a & 0xFF;
+  const int32_t  y0 = SIN_LUT[i], y1 = SIN_LUT[i + 1];
+  return (int16_t)(y0 + (((y1 - y0) * f) >> 8));
+}
+static inline uint8_t mul8(uint8_t a, uint8_t b) {
+  return (uint8_t)(((uint16_t)a * (uint16_t)(b + 1)) >> 8);
+}
+static RgbColor hsv2rgb16(uint16_t h, uint8_t s, uint8_t v) {
+  const uint32_t h6 = (uint32_t)h * 6;          // sector in bits 16..18
+  const uint8_t  i  = (uint8_t)(h6 >> 16);
+  const uint8_t  f  = (uint8_t)(h6 >> 8);       // position within sector
+  const uint8_t  p  = mul8(v, 255 - s);
+  const uint8_t  q  = mul8(v, 255 - mul8(f, s));
+  const uint8_t  t  = mul8(v, 255 - mul8(255 - f, s));
+  switch (i) {
+    case 0:  return RgbColor(v, t, p);
+    case 1:  return RgbColor(q, v, p);
+    case 2:  return RgbColor(p, v, t);
+    case 3:  return RgbColor(p, q, v);
+    case 4:  return RgbColor(t, p, v);
+    default: return RgbColor(v, p, q);
+  }
+}
+// t = 0..255 -> a .. (almost) b
+static inline RgbColor lerp8(const RgbColor& a, const RgbColor& b, uint8_t t) {
+  return RgbColor(
+    (uint8_t)(a.R + ((((int16_t)b.R - a.R) * t) >> 8)),
+    (uint8_t)(a.G + ((((int16_t)b.G - a.G) * t) >> 8)),
+    (uint8_t)(a.B + ((((int16_t)b.B - a.B) * t) >> 8))
+  );
+}
+static RgbColor samplePalette16(uint16_t x, uint8_t n, const RgbColor p[4], uint8_t blend) {
+  // Hard step vs smooth blend controlled by 'intensity'/blend (0=steps, 255=full)
+  if (n == 1) return p[0];
+  const uint32_t pos = (uint32_t)x * n;         // 16.16: entry . fraction
+  const uint8_t  i0  = (uint8_t)(pos >> 16);
+  const uint8_t  i1  = (uint8_t)((i0 + 1 == n) ? 0 : i0 + 1);
+  if (blend == 0) return p[i0];
+  const uint8_t  t   = mul8((uint8_t)(pos >> 8), blend);
+  return lerp8(p[i0], p[i1], t);
+}
+static inline RgbColor scale8(const RgbColor& c, uint8_t k) {
+  return RgbColor(mul8(c.R, k), mul8(c.G, k), mul8(c.B, k));
+}
+
+#endif // RGBCTRL_FLOAT_KERNELS
+
+static void loadPalette(uint8_t& n, RgbColor p[4]){
+  n = clampPaletteCount(FX->p.paletteCount);
+  uint32_t src[4] = { FX->p.colorA, FX->p.colorB, FX->p.colorC, FX->p.colorD };
+  for (uint8_t i=0;i<4;i++) p[i] = rgbFrom32(src[i]);
 }
 
 // ---------- Extra helpers for richer color when only Color A is set ----------
@@ -280,24 +962,25 @@ static void loadMotionPalette(uint8_t& n, RgbColor p[4]){
   float s2 = fclampf(s * 0.85f, 0.f, 1.f);
   float v1 = fclampf(v * 1.05f, 0.f, 1.f);
   float v2 = fclampf(v * 0.92f, 0.f, 1.f);
-  p[0] = hsv2rgb(h,                 s,  v);
-  p[1] = hsv2rgb(fmodf(h + 0.08f,1), s1, v1);
-  p[2] = hsv2rgb(fmodf(h + 0.33f,1), s2, v1);
-  p[3] = hsv2rgb(fmodf(h + 0.58f,1), s,  v2);
+  const uint16_t h16 = fracToTurns16(h);
+  p[0] = hsv2rgb16(h16,                          (uint8_t)(s*255),  (uint8_t)(v*255));
+  p[1] = hsv2rgb16(h16 + fracToTurns16(0.08f), (uint8_t)(s1*255), (uint8_t)(v1*255));
+  p[2] = hsv2rgb16(h16 + fracToTurns16(0.33f), (uint8_t)(s2*255), (uint8_t)(v1*255));
+  p[3] = hsv2rgb16(h16 + fracToTurns16(0.58f), (uint8_t)(s*255),  (uint8_t)(v2*255));
   n = 4;
 }
 
 // -------------------- Animations --------------------
-static void animSolid() { fillRing(rgbFrom24(CFG.colorA)); }
+static void animSolid() { fillRing(rgbFrom24(FX->p.colorA)); }
 
 // ---- UPDATED: smoother Breathe (ease + low-pass to remove stepping) ----
 static void animBreathe() {
   uint16_t L = ringLen(); if (!L) return;
 
   // Phase advances with speed; keep independent of tick granularity
-  static float phase = 0.f;
-  float step = 0.010f + (CFG.speed / 255.0f) * 0.045f; // ~slow → faster
-  phase += step;
+  float& phase = FX->st.breathePhase;
+  float step = 0.010f + (FX->p.speed / 255.0f) * 0.045f; // ~slow → faster
+  phase += step * FX->frameTicks;
 
   // Base waveform 0..1 and eased (smoothstep) to avoid harsh edges
   float s = 0.5f + 0.5f * sinf(phase * 6.2831853f);
@@ -307,11 +990,11 @@ static void animBreathe() {
   float target = 0.10f + 0.90f * eased;
 
   // Low-pass filter the level to smooth frame pacing artifacts
-  static float lvl = 0.0f;
-  float alpha = 0.10f;                       // smoothing factor
+  float& lvl = FX->st.breatheLvl;
+  float alpha = 1.0f - powf(0.90f, FX->frameTicks); // 0.10 per tick
   lvl = lvl*(1.0f - alpha) + target*alpha;  // 0..1
 
-  RgbColor base = rgbFrom24(CFG.colorA);
+  RgbColor base = rgbFrom24(FX->p.colorA);
   RgbColor cur(
     (uint8_t)(base.R * lvl),
     (uint8_t)(base.G * lvl),
@@ -323,49 +1006,49 @@ static void animBreathe() {
 static void animColorWipe(bool forward=true) {
   uint16_t L = ringLen(); if (!L) return;
   RgbColor off(0,0,0); fillRing(off);
-  uint16_t idx = (tick/2) % L;
+  uint16_t idx = (FX->tick/2) % L;
   // colorful head
   uint8_t n; RgbColor pal[4]; loadMotionPalette(n, pal);
-  float phase = tick * (0.003f + (CFG.speed/255.0f)*0.008f);
-  RgbColor c = samplePalette((idx/(float)L) + phase, n, pal, CFG.intensity);
+  const uint16_t phase = fracToTurns16(FX->tickF * (0.003f + (FX->p.speed/255.0f)*0.008f));
+  RgbColor c = samplePalette16(ringTurns16(idx, L) + phase, n, pal, FX->p.intensity);
   setRing(forward ? idx : (L-1-idx), c);
 }
 static void animLarson() {
   uint16_t L = ringLen(); if (!L) return;
-  int denom = 6 - (CFG.speed/51); if (denom < 1) denom = 1;
-  uint16_t pos = (tick / (uint16_t)denom) % (L*2);
+  int denom = 6 - (FX->p.speed/51); if (denom < 1) denom = 1;
+  uint16_t pos = (FX->tick / (uint16_t)denom) % (L*2);
   if (pos >= L) pos = 2*L - 1 - pos;
-  int fadeBase = 10 + CFG.intensity; if (fadeBase > 254) fadeBase = 254;
+  int fadeBase = 10 + FX->p.intensity; if (fadeBase > 254) fadeBase = 254;
   uint8_t fadeAmt = (uint8_t)(255 - fadeBase);
   fadeRing(fadeAmt);
   uint8_t n; RgbColor pal[4]; loadMotionPalette(n, pal);
-  float phase = tick * 0.006f;
-  for (int w=-(int)CFG.width; w<=(int)CFG.width; ++w) {
+  const uint16_t phase = fracToTurns16(FX->tickF * 0.006f);
+  for (int w=-(int)FX->p.width; w<=(int)FX->p.width; ++w) {
     int p = (int)pos + w;
     if (p>=0 && p<(int)L) {
-      RgbColor c = samplePalette((p/(float)L)+phase, n, pal, CFG.intensity);
+      RgbColor c = samplePalette16(ringTurns16((uint16_t)p, L) + phase, n, pal, FX->p.intensity);
       setRing((uint16_t)p, c);
     }
   }
 }
 static void animRainbow() {
   uint16_t L = ringLen(); if (!L) return;
-  int denom = 6 - (CFG.speed/51); if (denom < 1) denom = 1;
-  uint8_t offset = tick / (uint8_t)denom;
+  int denom = 6 - (FX->p.speed/51); if (denom < 1) denom = 1;
+  uint8_t offset = FX->tick / (uint8_t)denom;
   for (uint16_t i=0;i<L;++i) setRing(i, wheel((i*256/L + offset) & 255));
 }
 static void animTheater() {
   uint16_t L = ringLen(); if (!L) return;
-  int denom = 10 - (CFG.speed/32); if (denom < 1) denom = 1;
-  uint8_t gap = (CFG.width < 1) ? 1 : CFG.width;
-  uint8_t q = (tick / (uint8_t)denom) % gap;
-  int fadeBase = 10 + CFG.intensity; if (fadeBase > 254) fadeBase = 254;
+  int denom = 10 - (FX->p.speed/32); if (denom < 1) denom = 1;
+  uint8_t gap = (FX->p.width < 1) ? 1 : FX->p.width;
+  uint8_t q = (FX->tick / (uint8_t)denom) % gap;
+  int fadeBase = 10 + FX->p.intensity; if (fadeBase > 254) fadeBase = 254;
   uint8_t fadeAmt = (uint8_t)(255 - fadeBase);
   fadeRing(fadeAmt);
   uint8_t n; RgbColor pal[4]; loadMotionPalette(n, pal);
-  float phase = tick * 0.0045f;
+  const uint16_t phase = fracToTurns16(FX->tickF * 0.0045f);
   for (uint16_t i=q; i<L; i+=gap) {
-    RgbColor c = samplePalette((i/(float)L)+phase, n, pal, CFG.intensity);
+    RgbColor c = samplePalette16(ringTurns16(i, L) + phase, n, pal, FX->p.intensity);
     setRing(i, c);
   }
 }
@@ -375,72 +1058,63 @@ static void animTwinkle() {
   uint16_t L = ringLen(); if (!L) return;
 
   // Fade background (speed controls fade speed)
-  int f = 18 + (CFG.speed/2); if (f > 254) f = 254;
+  int f = 18 + (FX->p.speed/2); if (f > 254) f = 254;
   uint8_t fadeAmt = (uint8_t)(255 - f);
   fadeRing(fadeAmt);
 
-  // Per-pixel twinkle phase 0=off, 1..255 = active progress
-  static uint8_t phase[MAX_RING] = {0};
+  // Per-pixel twinkle phase (8.8): 0=off, 1..255 = active progress
+  uint16_t* phase = FX->st.twinkle;
 
-  // Number of new twinkles per frame (scales with intensity and ring size)
-  uint16_t pops = 1 + (uint16_t)((CFG.intensity * L) / (255 * 30) + 0.5f); // up to ~7 on 200px
+  // Number of new twinkles per tick (scales with intensity and ring size)
+  uint16_t pops = 1 + (uint16_t)((FX->p.intensity * L) / (255 * 30) + 0.5f); // up to ~7 on 200px
 
   // Spawn new twinkles on currently inactive pixels
-  for (uint16_t n=0; n<pops; ++n) {
-    uint16_t k = esp_random() % L;
-    if (phase[k] == 0) phase[k] = 1 + (esp_random() & 1); // start
+  float& spawnAcc = FX->st.spawnAcc;
+  spawnAcc += pops * FX->frameTicks;
+  for (; spawnAcc >= 1.f; spawnAcc -= 1.f) {
+    uint16_t k = fxRand() % L;
+    if (phase[k] == 0) phase[k] = (uint16_t)(1 + (fxRand() & 1)) << 8; // start
   }
 
   // Palette for coloration
   uint8_t pn; RgbColor pal[4]; loadMotionPalette(pn, pal);
-  float palPhase = tick * 0.0025f;
+  const uint16_t palPhase = fracToTurns16(FX->tickF * 0.0025f);
 
-  // Per-frame phase advance: higher speed = faster glint; width lengthens the glint
-  int advance = 2 + (CFG.speed / 24) - (CFG.width / 6);
+  // Per-tick phase advance: higher speed = faster glint; width lengthens the glint
+  int advance = 2 + (FX->p.speed / 24) - (FX->p.width / 6);
   if (advance < 1) advance = 1;
+  const uint32_t adv16 = (uint32_t)(advance * 256.0f * FX->frameTicks + 0.5f);
 
   for (uint16_t i=0; i<L; ++i) {
-    uint8_t ph = phase[i];
+    uint16_t ph = phase[i];
     if (ph == 0) continue;
 
-    // Normalize to 0..1 and give a sharp twinkle curve (sin^3)
-    float x = ph / 255.0f;
-    float b = sinf(3.1415926f * x);
-    b = b*b*b; // sharper peak
+    // Map progress onto half a sine turn and sharpen the peak (sin^3)
+    const int32_t b  = sin16((uint16_t)(((uint32_t)ph << 15) / (255u << 8)));  // Q15, >= 0
+    const int32_t b3 = (((b * b) >> 15) * b) >> 15;
 
     // Sample palette and scale by brightness
-    float u = (i/(float)L) + palPhase;
-    RgbColor base = samplePalette(u, pn, pal, CFG.intensity);
-    RgbColor c(
-      (uint8_t)(base.R * b),
-      (uint8_t)(base.G * b),
-      (uint8_t)(base.B * b)
-    );
-    setRing(i, c);
+    RgbColor base = samplePalette16(ringTurns16(i, L) + palPhase, pn, pal, FX->p.intensity);
+    setRing(i, scale8(base, (uint8_t)(b3 >> 7)));
 
     // Advance / finish
-    uint16_t next = ph + advance;
-    phase[i] = (next >= 255) ? 0 : (uint8_t)next;
+    uint32_t next = ph + adv16;
+    phase[i] = (next >= (255u << 8)) ? 0 : (uint16_t)next;
   }
 }
 
 static void animComet() {
   uint16_t L = ringLen(); if (!L) return;
-  int denom = 4 - (CFG.speed/64); if (denom < 1) denom = 1;
-  uint16_t pos = (tick / (uint16_t)denom) % L;
-  uint8_t fadeAmt = (uint8_t)(200 - (CFG.intensity > 199 ? 199 : CFG.intensity));
+  int denom = 4 - (FX->p.speed/64); if (denom < 1) denom = 1;
+  uint16_t pos = (FX->tick / (uint16_t)denom) % L;
+  uint8_t fadeAmt = (uint8_t)(200 - (FX->p.intensity > 199 ? 199 : FX->p.intensity));
   fadeRing(fadeAmt);
   uint8_t n; RgbColor pal[4]; loadMotionPalette(n, pal);
-  float phase = tick * 0.0055f;
-  RgbColor head = samplePalette((pos/(float)L)+phase, n, pal, CFG.intensity);
-  for (uint8_t w=0; w<CFG.width; ++w) {
-    float tail = 1.0f - (w/(float)CFG.width);
-    RgbColor c(
-      (uint8_t)(head.R * tail),
-      (uint8_t)(head.G * tail),
-      (uint8_t)(head.B * tail)
-    );
-    setRing((pos + L - w) % L, c);
+  const uint16_t phase = fracToTurns16(FX->tickF * 0.0055f);
+  RgbColor head = samplePalette16(ringTurns16(pos, L) + phase, n, pal, FX->p.intensity);
+  for (uint8_t w=0; w<FX->p.width; ++w) {
+    const uint8_t tail = (uint8_t)(255 - (uint16_t)w * 255 / FX->p.width);
+    setRing((pos + L - w) % L, scale8(head, tail));
   }
 }
 
@@ -449,48 +1123,48 @@ static void animMeteor() {
   uint16_t L = ringLen(); if (!L) return;
 
   // Fade existing trails
-  uint8_t fadeAmt = (uint8_t)(210 - (CFG.intensity > 209 ? 209 : CFG.intensity));
+  uint8_t fadeAmt = (uint8_t)(210 - (FX->p.intensity > 209 ? 209 : FX->p.intensity));
   fadeRing(fadeAmt);
 
   // How many concurrent meteors (1..8)
-  const uint8_t MAXM = 8;
-  uint8_t count = 1 + (uint8_t)((CFG.intensity * (MAXM-1)) / 255);
+  const uint8_t MAXM = METEOR_MAX;
+  uint8_t count = 1 + (uint8_t)((FX->p.intensity * (MAXM-1)) / 255);
 
   // Persistent meteor state
-  static bool   inited = false;
-  static float  pos[MAXM];
-  static float  vel[MAXM];
-  static uint8_t len[MAXM];
-  static uint16_t lastL = 0;
+  FxState& st = FX->st;
+  bool&     inited = st.meteorInit;
+  float*    pos    = st.mPos;
+  float*    vel    = st.mVel;
+  uint8_t*  len    = st.mLen;
+  uint16_t& lastL  = st.mLastL;
 
   if (!inited || lastL != L) {
     for (uint8_t m=0; m<MAXM; ++m) {
-      pos[m] = (float)(esp_random() % L);
-      vel[m] = 0.35f + 1.25f * ((esp_random() & 255) / 255.0f); // px/frame
-      len[m] = 2 + (esp_random() % 6);
+      pos[m] = (float)(fxRand() % L);
+      vel[m] = 0.35f + 1.25f * ((fxRand() & 255) / 255.0f); // px/frame
+      len[m] = 2 + (fxRand() % 6);
     }
     inited = true;
     lastL = L;
   }
 
   // Tail length mapped to width (2..(2+2*width))
-  uint8_t baseTail = 2 + (uint8_t)(CFG.width * 2);
+  uint8_t baseTail = 2 + (uint8_t)(FX->p.width * 2);
 
   // Palette
   uint8_t pn; RgbColor pal[4]; loadMotionPalette(pn, pal);
-  float pphase = tick * 0.004f;
+  const uint16_t pphase = fracToTurns16(FX->tickF * 0.004f);
 
   // Speed multiplier (higher speed slider => faster meteors)
-  float speedMul = 0.5f + 2.0f * (CFG.speed / 255.0f);
+  float speedMul = 0.5f + 2.0f * (FX->p.speed / 255.0f);
 
   for (uint8_t m=0; m<count; ++m) {
     // Advance & wrap
-    pos[m] += vel[m] * speedMul;
+    pos[m] += vel[m] * speedMul * FX->frameTicks;
     while (pos[m] >= L) pos[m] -= L;
 
     // Color head from palette varying by position
-    float hu = (pos[m] / (float)L) + pphase;
-    RgbColor head = samplePalette(hu, pn, pal, CFG.intensity);
+    RgbColor head = samplePalette16(ringTurns16((uint16_t)pos[m], L) + pphase, pn, pal, FX->p.intensity);
 
     // Draw head
     setRing((uint16_t)pos[m], head);
@@ -498,34 +1172,28 @@ static void animMeteor() {
     // Draw tapered tail behind the head
     uint8_t tl = baseTail + len[m];
     for (uint8_t k=1; k<=tl; ++k) {
-      float t = k / (float)tl;  // 0..1
-      float fall = (1.0f - t);
-      fall *= fall;             // quadratic falloff
-      RgbColor c(
-        (uint8_t)(head.R * fall),
-        (uint8_t)(head.G * fall),
-        (uint8_t)(head.B * fall)
-      );
+      const uint16_t rem  = 255 - (uint16_t)k * 255 / tl;   // 1 - t
+      const uint8_t  fall = (uint8_t)((rem * rem) / 255);    // quadratic falloff
       uint16_t p = ((int)pos[m] - k + L*4) % L;
-      setRing(p, c);
+      setRing(p, scale8(head, fall));
     }
 
     // Occasionally randomize a meteor to keep the shower organic
-    if ((esp_random() & 255) < 4) {
-      vel[m] = 0.35f + 1.25f * ((esp_random() & 255) / 255.0f);
-      len[m] = 2 + (esp_random() % 6);
+    if ((fxRand() & 0xFFFF) < (uint32_t)(1024.0f * FX->frameTicks)) {
+      vel[m] = 0.35f + 1.25f * ((fxRand() & 255) / 255.0f);
+      len[m] = 2 + (fxRand() % 6);
     }
   }
 }
 
 static void animClockSpin() {
   uint16_t L = ringLen(); if (!L) return;
-  int denom = 3 - (CFG.speed/85); if (denom < 1) denom = 1;
-  uint16_t pos = (tick / (uint16_t)denom) % L;
-  RgbColor bg = rgbFrom24(CFG.colorB);
-  RgbColor fg = rgbFrom24(CFG.colorA);
+  int denom = 3 - (FX->p.speed/85); if (denom < 1) denom = 1;
+  uint16_t pos = (FX->tick / (uint16_t)denom) % L;
+  RgbColor bg = rgbFrom24(FX->p.colorB);
+  RgbColor fg = rgbFrom24(FX->p.colorA);
   fillRing(bg);
-  uint8_t span = (uint8_t)(CFG.width*2+1);
+  uint8_t span = (uint8_t)(FX->p.width*2+1);
   if (span < 1) span = 1;
   for (uint8_t w=0; w<span; ++w) setRing((pos + w) % L, fg);
 }
@@ -534,35 +1202,44 @@ static void animClockSpin() {
 static void animPlasma() {
   uint16_t L = ringLen(); if (!L) return;
 
-  static float t = 0.f;
-  float tstep = 0.015f + (CFG.speed / 255.0f) * 0.050f;
-  t += tstep;
+  float& t = FX->st.plasmaT;
+  float tstep = 0.015f + (FX->p.speed / 255.0f) * 0.050f;
+  t += tstep * FX->frameTicks;
 
   const float drift = sinf(t * 0.23f) * 0.35f + sinf(t * 0.11f + 1.3f) * 0.15f;
 
   // User controls mapping
-  const float satBase  = 0.55f + (CFG.intensity / 255.0f) * 0.45f; // 0.55..1.0
-  const float contrast = 0.90f + (CFG.width     / 20.0f) * 0.60f;  // ~0.9..1.5
-  const float sparkAmp = 0.06f * (CFG.intensity / 255.0f);
+  const float satBase  = 0.55f + (FX->p.intensity / 255.0f) * 0.45f; // 0.55..1.0
+  const float contrast = 0.90f + (FX->p.width     / 20.0f) * 0.60f;  // ~0.9..1.5
+  const float sparkAmp = 0.06f * (FX->p.intensity / 255.0f);
+
+  // Per-frame terms in fixed point; the pixel loop is integer only.
+  const uint16_t T1 = radToTurns16(t);
+  const uint16_t T2 = radToTurns16(-t * 0.8f + drift);
+  const uint16_t T3 = radToTurns16(t * 1.6f);
+  const uint16_t T4 = radToTurns16(-t * 2.2f);
+  const uint16_t TH = fracToTurns16(t * 0.05f);
+  const int32_t  contrastQ8 = (int32_t)(contrast * 256.0f);
+  const int32_t  sparkQ15   = (int32_t)(sparkAmp * 32768.0f);
+  const uint8_t  sat        = (uint8_t)(satBase * 255.0f);
 
   for (uint16_t i=0; i<L; ++i) {
-    const float u = (float)i / (float)L;
-    const float a = u * 6.2831853f; // 0..2π
+    const uint16_t A = ringTurns16(i, L);        // 0..2π
 
-    // Multi-octave sine field
-    const float f1 = sinf(3.0f * a + t)                * 0.55f;
-    const float f2 = sinf(5.0f * a - t * 0.8f + drift) * 0.35f;
-    const float f3 = sinf(6.3f * a + t * 1.6f)         * 0.20f;
-    float field = (f1 + f2 + f3) * 0.5f + 0.5f; // normalize to ~0..1
+    // Multi-octave sine field (Q15 weights 0.55 / 0.35 / 0.20)
+    const int32_t f1 = ((int32_t)sin16((uint16_t)(3u * A) + T1) * 18022) >> 15;
+    const int32_t f2 = ((int32_t)sin16((uint16_t)(5u * A) + T2) * 11469) >> 15;
+    const int32_t f3 = ((int32_t)sin16((uint16_t)(((uint32_t)A * 6451u) >> 10) + T3) * 6554) >> 15; // 6.3a
+    const int32_t field = ((f1 + f2 + f3) >> 1) + 16384;  // Q15, ~0..1
 
     // Local sparkle + contrast
-    float v = field * contrast + sparkAmp * sinf(a * 8.0f - t * 2.2f);
-    if (v < 0.f) v = 0.f; if (v > 1.f) v = 1.f;
+    int32_t v = ((field * contrastQ8) >> 8) + ((sparkQ15 * sin16((uint16_t)(8u * A) + T4)) >> 15);
+    if (v < 0) v = 0; if (v > 32767) v = 32767;
 
-    const float hue = fmodf(field * 1.2f + t * 0.05f, 1.0f);
-    const float sat = satBase;
+    // hue = field*1.2 + t*0.05 (turns; uint16 wrap is the fmod)
+    const uint16_t hue = (uint16_t)((field * 12 / 5) + TH);
 
-    setRing(i, hsv2rgb(hue, sat, v));
+    setRing(i, hsv2rgb16(hue, sat, (uint8_t)(v >> 7)));
   }
 }
 
@@ -575,27 +1252,36 @@ static void animFire() {
   const uint8_t SPARK_ADD_BASE = 180; // was 160 (hotter sparks)
   const uint8_t HEAT_BIAS = 65;   // +20 heat before color map (push into yellow/white a bit)
 
-  // 1) cool down each cell a little
-  uint8_t cool = COOL_BASE - (uint8_t)((uint16_t)CFG.intensity * COOL_SPAN / 255); // ~14..50
-  for (uint16_t i = 0; i < L; ++i) {
-    uint8_t dec = esp_random() % (cool + 1);
-    heat[i] = (heat[i] > dec) ? (heat[i] - dec) : 0;
-  }
+  // The simulation steps once per clock tick (cap the catch-up after stalls)
+  uint16_t& lastFireTick = FX->st.lastFireTick;
+  uint8_t*  heat         = FX->st.heat;
+  uint16_t steps = (uint16_t)(FX->tick - lastFireTick);
+  lastFireTick = FX->tick;
+  if (steps > 4) steps = 4;
+
+  for (uint16_t st = 0; st < steps; ++st) {
+    // 1) cool down each cell a little
+    uint8_t cool = COOL_BASE - (uint8_t)((uint16_t)FX->p.intensity * COOL_SPAN / 255); // ~14..50
+    for (uint16_t i = 0; i < L; ++i) {
+      uint8_t dec = fxRand() % (cool + 1);
+      heat[i] = (heat[i] > dec) ? (heat[i] - dec) : 0;
+    }
 
-  // 2) heat diffuses (blur)
-  for (uint16_t i = 0; i < L; ++i) {
-    uint16_t i1 = (i + L - 1) % L;
-    uint16_t i2 = (i + 1) % L;
-    heat[i] = (uint8_t)((heat[i] + heat[i1] + heat[i2]) / 3);
-  }
+    // 2) heat diffuses (blur)
+    for (uint16_t i = 0; i < L; ++i) {
+      uint16_t i1 = (i + L - 1) % L;
+      uint16_t i2 = (i + 1) % L;
+      heat[i] = (uint8_t)((heat[i] + heat[i1] + heat[i2]) / 3);
+    }
 
-  // 3) random sparks (a bit hotter than before)
-  uint8_t sparks = 1 + (CFG.speed / 64); // 1..5
-  for (uint8_t s = 0; s < sparks; ++s) {
-    uint16_t p = esp_random() % L;
-    uint16_t add = SPARK_ADD_BASE + (esp_random() % 96); // 180..275
-    uint16_t v = (uint16_t)heat[p] + add;
-    heat[p] = (v > 255) ? 255 : (uint8_t)v;
+    // 3) random sparks (a bit hotter than before)
+    uint8_t sparks = 1 + (FX->p.speed / 64); // 1..5
+    for (uint8_t s = 0; s < sparks; ++s) {
+      uint16_t p = fxRand() % L;
+      uint16_t add = SPARK_ADD_BASE + (fxRand() % 96); // 180..275
+      uint16_t v = (uint16_t)heat[p] + add;
+      heat[p] = (v > 255) ? 255 : (uint8_t)v;
+    }
   }
 
   // 4) map heat to color (biased a bit upward → less red, more yellow/white)
@@ -626,11 +1312,10 @@ static void animPaletteCycle() {
   uint16_t L = ringLen(); if (!L) return;
   uint8_t n; RgbColor pal[4]; loadPalette(n, pal);
 
-  int denom = 6 - (CFG.speed/51); if (denom < 1) denom = 1;
-  float offset = (tick / (float)denom) * 0.015f; // rotation factor
+  int denom = 6 - (FX->p.speed/51); if (denom < 1) denom = 1;
+  const uint16_t offset = fracToTurns16((FX->tickF / (float)denom) * 0.015f); // rotation factor
   for (uint16_t i=0;i<L;++i) {
-    float x = (i / (float)L) + offset;
-    setRing(i, samplePalette(x, n, pal, CFG.intensity));
+    setRing(i, samplePalette16(ringTurns16(i, L) + offset, n, pal, FX->p.intensity));
   }
 }
 
@@ -639,21 +1324,21 @@ static void animPaletteChase() {
   uint16_t L = ringLen(); if (!L) return;
   uint8_t n; RgbColor pal[4]; loadPalette(n, pal);
 
-  uint16_t block = (CFG.width < 1) ? 1 : CFG.width;
-  int denom = 4 - (CFG.speed/64); if (denom < 1) denom = 1;
-  uint16_t pos = (tick / (uint16_t)denom) % L;
+  uint16_t block = (FX->p.width < 1) ? 1 : FX->p.width;
+  int denom = 4 - (FX->p.speed/64); if (denom < 1) denom = 1;
+  uint16_t pos = (FX->tick / (uint16_t)denom) % L;
 
   for (uint16_t i=0;i<L;++i) {
     uint16_t k = (i + L - pos) % L;   // shift by pos for motion
     uint16_t which = (k / block) % n; // palette index
     RgbColor base = pal[which];
 
-    if (CFG.intensity == 0) { setRing(i, base); continue; }
+    if (FX->p.intensity == 0) { setRing(i, base); continue; }
 
     // Soft edges using intensity as softening at block edges
     uint16_t edge = k % block;
     float tEdge = fabsf((edge - (block-1)/2.0f)) / (block/2.0f); // 0 center .. 1 edge
-    float soft = 1.0f - (CFG.intensity/255.0f) * tEdge;          // 1 center .. (1-α) edge
+    float soft = 1.0f - (FX->p.intensity/255.0f) * tEdge;          // 1 center .. (1-α) edge
     if (soft < 0.f) soft = 0.f;
     RgbColor c = RgbColor(
       (uint8_t)(base.R * soft),
@@ -664,91 +1349,317 @@ static void animPaletteChase() {
   }
 }
 
-// -------------------- NEW: Custom sequence (playlist) --------------------
-struct CustomStep {
-  uint8_t  mode = MODE_SOLID;
-  uint16_t duration = 1000; // ms
-  // Optional overrides
-  bool hasSpeed=false;     uint8_t speed=0;
-  bool hasIntensity=false; uint8_t intensity=0;
-  bool hasWidth=false;     uint8_t width=0;
-  bool hasPCnt=false;      uint8_t pcount=0;
-  bool hasA=false;         uint32_t colorA=0;
-  bool hasB=false;         uint32_t colorB=0;
-  bool hasC=false;         uint32_t colorC=0;
-  bool hasD=false;         uint32_t colorD=0;
-};
+// ---- Sensor-reactive modes ----
+// Sensor level 0..1 across [lo, hi], eased over ~1 s so 1 °C / 2 % steps
+// don't snap. No value (SMBus off, guarded, stale) reads as 0: Color A and
+// the slowest motion.
+static float reactLevel(RGBsmbus::Sensor s, float lo, float hi) {
+  const RGBsmbus::SensorValue v = RGBsmbus::sensor(s);
+  float target = 0.f;
+  if (v.valid && !v.stale) target = (v.value - lo) / (hi - lo);
+  if (target < 0.f) target = 0.f; if (target > 1.f) target = 1.f;
+  float& lvl = FX->st.reactLvl;
+  const float a = frameDtMs / 1000.0f;
+  lvl += (target - lvl) * (a > 1.f ? 1.f : a);
+  return lvl;
+}
+
+// Whole ring Color A (cool) -> Color B (hot); intensity adds a breathe that
+// quickens as it warms.
+static void animTempReact() {
+  uint16_t L = ringLen(); if (!L) return;
+  const float t = reactLevel(RGBsmbus::SENSOR_CPU_C, RGBCTRL_REACT_CPU_LO_C, RGBCTRL_REACT_CPU_HI_C);
+  RgbColor c = lerpF(rgbFrom24(FX->p.colorA), rgbFrom24(FX->p.colorB), t);
+
+  float& phase = FX->st.reactPhase;
+  phase += (0.004f + 0.030f * t) * FX->frameTicks;
+  if (phase >= 1.f) phase -= floorf(phase);
+  const float depth = 0.6f * (FX->p.intensity / 255.0f);
+  const float lvl = 1.0f - depth * (0.5f - 0.5f * cosf(phase * 6.2831853f));
+  fillRing(scale8(c, (uint8_t)(lvl * 255.0f)));
+}
+
+// 1..5 blades (width) that spin with the fan and shift Color A -> Color B as
+// it speeds up; intensity is the background glow between blades.
+static void animFanReact() {
+  uint16_t L = ringLen(); if (!L) return;
+  const float t = reactLevel(RGBsmbus::SENSOR_FAN_PCT, 0.f, 100.f);
+  RgbColor c = lerpF(rgbFrom24(FX->p.colorA), rgbFrom24(FX->p.colorB), t);
 
-static bool parseCustomSteps(const String& js, std::vector<CustomStep>& out) {
-  out.clear();
-  if (!js.length()) return true;
+  float& pos = FX->st.reactPhase;                     // rotation, turns
+  pos += (0.002f + 0.040f * t) * FX->frameTicks;
+  if (pos >= 1.f) pos -= floorf(pos);
+
+  const uint8_t blades = 1 + FX->p.width / 5;
+  const float   glow   = 0.25f * (FX->p.intensity / 255.0f);
+  for (uint16_t i=0; i<L; ++i) {
+    float x = (float)i / L * blades - pos * blades;  // blade-relative position
+    x -= floorf(x);                                   // 0..1, blade centre at 0.5
+    const float d = fabsf(x - 0.5f) * 2.0f;           // 0 centre .. 1 gap
+    float k = 1.0f - d * d * 2.0f;
+    if (k < glow) k = glow;
+    setRing(i, scale8(c, (uint8_t)(k * 255.0f)));
+  }
+}
+
+// -------------------- NEW: Custom sequence (playlist) --------------------
+// Step colours may be numbers (0xRRGGBB) or "#RRGGBB" strings.
+static uint32_t stepColor(JsonVariantConst v) {
+  if (v.is<const char*>()) {
+    const char* h = v.as<const char*>();
+    if (*h == '#') ++h;
+    return (uint32_t)strtoul(h, nullptr, 16) & 0xFFFFFF;
+  }
+  return v.as<uint32_t>();
+}
+
+// One step object (customSeq entry or zone) onto a compiled step.
+static void stepFromJson(JsonObjectConst o, PlayStep& s) {
+  int m = o.containsKey("mode") ? o["mode"].as<int>() : MODE_SOLID;
+  s.mode = (m < 0 || m == MODE_CUSTOM || m >= MODE_COUNT) ? MODE_SOLID : (uint8_t)m;   // no nested playlists
+  int dur = o.containsKey("duration") ? o["duration"].as<int>() : 1000;
+  if (dur < 1) dur = 1; if (dur > 60000) dur = 60000;
+  s.duration = (uint16_t)dur;
+  s.transition = STEP_XF_DEFAULT;
+  if (o.containsKey("transition")) {
+    int x = o["transition"].as<int>();
+    if (x < 0) x = 0; if (x > XF_MAX_MS) x = XF_MAX_MS;
+    s.transition = (uint16_t)x;
+  }
+  if (o.containsKey("speed"))       { s.has |= STEP_SPEED;     s.speed=o["speed"].as<uint8_t>(); }
+  if (o.containsKey("intensity"))   { s.has |= STEP_INTENSITY; s.intensity=o["intensity"].as<uint8_t>(); }
+  if (o.containsKey("width"))       { s.has |= STEP_WIDTH;     int w=o["width"].as<int>(); if(w<1)w=1; if(w>255)w=255; s.width=(uint8_t)w; }
+  if (o.containsKey("paletteCount")){ s.has |= STEP_PCNT;      uint8_t pc=o["paletteCount"].as<uint8_t>(); s.pcount=(pc<1)?1:((pc>4)?4:pc); }
+  if (o.containsKey("colorA"))      { s.has |= STEP_A; s.colorA=stepColor(o["colorA"]); }
+  if (o.containsKey("colorB"))      { s.has |= STEP_B; s.colorB=stepColor(o["colorB"]); }
+  if (o.containsKey("colorC"))      { s.has |= STEP_C; s.colorC=stepColor(o["colorC"]); }
+  if (o.containsKey("colorD"))      { s.has |= STEP_D; s.colorD=stepColor(o["colorD"]); }
+}
+
+// Compile a customSeq JSON array into a step table. Steps past MAX_STEPS are
+// dropped. Returns false (and leaves an empty table) if the JSON is invalid.
+static bool compilePlaylist(const char* js, Playlist& out) {
+  memset(&out, 0, sizeof(out));
+  if (!js || !*js) return true;
   StaticJsonDocument<2048> doc;
   auto err = deserializeJson(doc, js);
   if (err || !doc.is<JsonArray>()) return false;
-  for (JsonVariant v : doc.as<JsonArray>()) {
-    if (!v.is<JsonObject>()) continue;
-    JsonObject o = v.as<JsonObject>();
-    CustomStep s;
-    s.mode = (uint8_t) (o.containsKey("mode") ? o["mode"].as<int>() : MODE_SOLID);
-    int dur = o.containsKey("duration") ? o["duration"].as<int>() : 1000;
-    if (dur < 1) dur = 1; if (dur > 60000) dur = 60000;
-    s.duration = (uint16_t)dur;
-    if (o.containsKey("speed"))       { s.hasSpeed=true;     s.speed=o["speed"].as<uint8_t>(); }
-    if (o.containsKey("intensity"))   { s.hasIntensity=true; s.intensity=o["intensity"].as<uint8_t>(); }
-    if (o.containsKey("width"))       { s.hasWidth=true;     int w=o["width"].as<int>(); if(w<1)w=1; if(w>255)w=255; s.width=(uint8_t)w; }
-    if (o.containsKey("paletteCount")){ s.hasPCnt=true;      uint8_t pc=o["paletteCount"].as<uint8_t>(); s.pcount=(pc<1)?1:((pc>4)?4:pc); }
-    if (o.containsKey("colorA"))      { s.hasA=true; s.colorA=o["colorA"].as<uint32_t>(); }
-    if (o.containsKey("colorB"))      { s.hasB=true; s.colorB=o["colorB"].as<uint32_t>(); }
-    if (o.containsKey("colorC"))      { s.hasC=true; s.colorC=o["colorC"].as<uint32_t>(); }
-    if (o.containsKey("colorD"))      { s.hasD=true; s.colorD=o["colorD"].as<uint32_t>(); }
-    out.push_back(s);
+  for (JsonObjectConst o : doc.as<JsonArrayConst>()) {
+    if (o.isNull()) continue;
+    if (out.n >= MAX_STEPS) break;
+    stepFromJson(o, out.step[out.n++]);
+  }
+  return true;
+}
+
+// Compile a zones JSON array into a zone table. Each zone is a customSeq step
+// (mode and parameter overrides) plus "ch": a list of channels (0..3, whole
+// channel) and/or [ch, start, len] ranges in ring direction, and optional
+// "fps". Zones past MAX_ZONES or without a valid range are dropped.
+static bool compileZones(const char* js, ZoneTable& out) {
+  memset(&out, 0, sizeof(out));
+  if (!js || !*js) return true;
+  StaticJsonDocument<1536> doc;
+  auto err = deserializeJson(doc, js);
+  if (err || !doc.is<JsonArray>()) return false;
+  for (JsonObjectConst o : doc.as<JsonArrayConst>()) {
+    if (o.isNull()) continue;
+    if (out.n >= MAX_ZONES) break;
+    ZoneDef& z = out.z[out.n];
+    memset(&z, 0, sizeof(z));
+    for (JsonVariantConst c : o["ch"].as<JsonArrayConst>()) {
+      if (z.nSpan >= ZONE_SPANS) break;
+      ZoneSpan sp = { 0, 0, SPAN_TO_END };
+      if (c.is<JsonArrayConst>()) {
+        sp.ch = c[0].as<uint8_t>(); sp.start = c[1].as<uint16_t>();
+        sp.len = c[2].isNull() ? SPAN_TO_END : c[2].as<uint16_t>();
+      } else {
+        sp.ch = c.as<uint8_t>();
+      }
+      if (sp.ch >= NUM_CH || !sp.len) continue;
+      z.span[z.nSpan++] = sp;
+    }
+    if (!z.nSpan) continue;
+    stepFromJson(o, z.p);
+    int f = o["fps"] | 0;
+    z.fps = (f <= 0) ? 0 : (uint8_t)((f < FPS_MIN) ? FPS_MIN : ((f > FPS_MAX) ? FPS_MAX : f));
+    ++out.n;
   }
   return true;
 }
 
-static void applyStepOverrides(const CustomStep& s) {
-  if (s.hasSpeed)     CFG.speed = s.speed;
-  if (s.hasIntensity) CFG.intensity = s.intensity;
-  if (s.hasWidth)     CFG.width = s.width;
-  if (s.hasPCnt)      CFG.paletteCount = s.pcount;
-  if (s.hasA)         CFG.colorA = s.colorA;
-  if (s.hasB)         CFG.colorB = s.colorB;
-  if (s.hasC)         CFG.colorC = s.colorC;
-  if (s.hasD)         CFG.colorD = s.colorD;
-}
-
-static void animCustom() {
-  static std::vector<CustomStep> seq;
-  static String lastJs;
-  static uint32_t stepStart=0;
-  static size_t idx=0;
-
-  // (Re)parse if changed
-  if (lastJs != CFG.customSeq) {
-    seq.clear();
-    parseCustomSteps(CFG.customSeq, seq);
-    lastJs = CFG.customSeq;
+// Rebuild the zones JSON (for the UI/wire) from a compiled table.
+static void zonesToJson(const ZoneTable& tab, String& out) {
+  out = "[";
+  char tmp[48];
+  auto field = [&](const char* k, uint32_t v) {
+    snprintf(tmp, sizeof(tmp), ",\"%s\":%lu", k, (unsigned long)v);
+    out += tmp;
+  };
+  for (uint8_t i=0; i<tab.n; ++i) {
+    const ZoneDef& z = tab.z[i];
+    if (i) out += ',';
+    out += "{\"ch\":[";
+    for (uint8_t k=0; k<z.nSpan; ++k) {
+      const ZoneSpan& sp = z.span[k];
+      if (k) out += ',';
+      if (!sp.start && sp.len == SPAN_TO_END) snprintf(tmp, sizeof(tmp), "%u", sp.ch);
+      else snprintf(tmp, sizeof(tmp), "[%u,%u,%u]", sp.ch, sp.start, sp.len);
+      out += tmp;
+    }
+    snprintf(tmp, sizeof(tmp), "],\"mode\":%u", z.p.mode);
+    out += tmp;
+    if (z.fps)                     field("fps",          z.fps);
+    if (z.p.has & STEP_SPEED)      field("speed",        z.p.speed);
+    if (z.p.has & STEP_INTENSITY)  field("intensity",    z.p.intensity);
+    if (z.p.has & STEP_WIDTH)      field("width",        z.p.width);
+    if (z.p.has & STEP_PCNT)       field("paletteCount", z.p.pcount);
+    if (z.p.has & STEP_A)          field("colorA",       z.p.colorA);
+    if (z.p.has & STEP_B)          field("colorB",       z.p.colorB);
+    if (z.p.has & STEP_C)          field("colorC",       z.p.colorC);
+    if (z.p.has & STEP_D)          field("colorD",       z.p.colorD);
+    out += '}';
+  }
+  out += ']';
+}
+
+// Step parameters are an overlay on the published base: fields a step doesn't
+// override come from the base, so one step's overrides never leak into the
+// next. Only the layer's copy is touched; CFG (and what gets saved) is not.
+static void applyStepOverlay(RenderCfg& p, const PlayStep& s) {
+  if (s.has & STEP_SPEED)     p.speed        = s.speed;
+  if (s.has & STEP_INTENSITY) p.intensity    = s.intensity;
+  if (s.has & STEP_WIDTH)     p.width        = s.width;
+  if (s.has & STEP_PCNT)      p.paletteCount = s.pcount;
+  if (s.has & STEP_A)         p.colorA       = s.colorA;
+  if (s.has & STEP_B)         p.colorB       = s.colorB;
+  if (s.has & STEP_C)         p.colorC       = s.colorC;
+  if (s.has & STEP_D)         p.colorD       = s.colorD;
+}
+
+// -------------------- Layers / compositor --------------------
+static const uint8_t MODE_BLACK = 0xFF;   // layer program: all off
+
+// Start a fresh effect instance: new state, clock at zero, black buffer.
+static void fxReset(FxLayer& L, uint8_t mode, const RenderCfg& p) {
+  uint16_t* const tw = L.st.twinkle;
+  uint8_t*  const ht = L.st.heat;
+  memset(&L.st, 0, sizeof(L.st));
+  if (L.cap) memset(L.buf, 0, L.cap * LAYER_PX_BYTES);   // buf, twinkle, heat
+  L.st.twinkle = tw; L.st.heat = ht;
+  L.st.rng = esp_random() | 1;     // xorshift must not start at 0
+  L.mode = mode;
+  L.p    = p;
+  L.tick = 0; L.tickFrac = 0.f; L.tickF = 0.f; L.frameTicks = 0.f;
+}
+
+// What the active layer is running; a different key starts a new instance.
+static uint32_t progKey     = 0xFFFFFFFF;
+static bool     progStarted = false;
+
+static void runProgram(uint32_t key, uint8_t mode, const RenderCfg& p, uint16_t transMs) {
+  if (key == progKey) {
+    layers[curLayer].p    = p;       // live edits (preview) apply in place
+    layers[curLayer].mode = mode;
+    return;
+  }
+  progKey = key;
+  if (transMs && progStarted) {
+    curLayer ^= 1;                   // old incoming becomes outgoing
+    xfActive = true; xfStartMs = millis(); xfDurMs = transMs;
+  } else {
+    xfActive = false;
+  }
+  fxReset(layers[curLayer], mode, p);
+  progStarted = true;
+}
+
+// Playlist sequencer: picks the current step and hands it to runProgram().
+// Position is file-scope so sync can read (leader) or set (follower) it;
+// seqCrc identifies the table so only matching playlists are locked.
+static uint32_t crc32(const void* data, size_t len);
+static volatile uint8_t  plIdx = 0;
+static volatile uint32_t plStepStart = 0;
+static volatile uint32_t plCrc = 0;
+static volatile bool     plActive = false;
+
+static void runPlaylist() {
+  static Playlist seq = {};
+  static uint32_t lastGen = 0xFFFFFFFF;
+  uint32_t stepStart = plStepStart;
+  uint8_t  idx = plIdx;
+
+  // Pick up a newly compiled table (integer compare per frame)
+  if (lastGen != RS.seqGen) {
+    takePlaylist(seq);
+    lastGen = RS.seqGen;
     idx = 0; stepStart = millis();
+    plCrc = seq.n ? crc32(seq.step, (size_t)seq.n * sizeof(PlayStep)) : 0;
   }
 
-  if (seq.empty()) {
+  // Follower: jump to the leader's step/position if we run the same table.
+  if (syncStepPending) {
+    portENTER_CRITICAL(&syncMux);
+    const SyncStepReq r = syncStep;
+    syncStepPending = false;
+    portEXIT_CRITICAL(&syncMux);
+    if (r.crc == plCrc && r.idx < seq.n) {
+      idx = r.idx;
+      stepStart = r.rxMs - r.stepMs;
+    }
+  }
+
+  plActive = seq.n != 0;
+  if (!seq.n) {
     // No steps → black (silence)
-    fillRing(RgbColor(0,0,0));
+    runProgram(0xFFFFFFFE, MODE_BLACK, RS, RS.transition);
+    plIdx = idx; plStepStart = stepStart;
     return;
   }
 
+  // Step advance
   uint32_t now = millis();
-  const CustomStep& s = seq[idx];
-
-  // Apply per-step parameter overrides when entering a step
-  static size_t lastIdx = (size_t)-1;
-  if (idx != lastIdx) {
-    applyStepOverrides(s);
-    lastIdx = idx;
+  if (now - stepStart >= seq.step[idx].duration) {
+    stepStart = now;
+    idx++;
+    if (idx >= seq.n) {
+      idx = RS.customLoop ? 0 : (uint8_t)(seq.n-1);
+    }
   }
 
-  // Run selected base mode with current CFG (overrides applied)
-  switch (s.mode) {
+  plIdx = idx; plStepStart = stepStart;
+
+  const PlayStep& s = seq.step[idx];
+  RenderCfg p = RS;
+  applyStepOverlay(p, s);
+  const uint16_t xf  = (s.transition != STEP_XF_DEFAULT) ? s.transition : RS.transition;
+  const uint32_t key = 0x80000000u | ((lastGen & 0x7FFFFF) << 8) | idx;
+  runProgram(key, s.mode, p, xf);
+}
+
+static void advanceLayerClock(FxLayer& L) {
+  L.frameTicks = frameDtMs / legacyFrameMs(L.p.speed);
+  if (syncOn) {
+    // Absolute: tick = show clock / tick length (wraps like the counter).
+    const uint64_t tUs  = (uint64_t)showClockUs();
+    const uint32_t tkUs = (uint32_t)legacyFrameMs(L.p.speed) * 1000u;
+    L.tick     = (uint16_t)(tUs / tkUs);
+    L.tickFrac = (float)(uint32_t)(tUs % tkUs) / (float)tkUs;
+    L.tickF    = (float)L.tick + L.tickFrac;
+    return;
+  }
+  L.tickFrac  += L.frameTicks;
+  const uint32_t whole = (uint32_t)L.tickFrac;
+  L.tick      += (uint16_t)whole;
+  L.tickFrac  -= (float)whole;
+  L.tickF      = (float)L.tick + L.tickFrac;
+}
+
+static void renderLayer(FxLayer& L) {
+  const uint32_t t0 = micros();
+  FX = &L;
+  advanceLayerClock(L);
+  switch (L.mode) {
     case MODE_SOLID:         animSolid();         break;
     case MODE_BREATHE:       animBreathe();       break;
     case MODE_COLOR_WIPE:    animColorWipe();     break;
@@ -763,103 +1674,445 @@ static void animCustom() {
     case MODE_FIRE:          animFire();          break;
     case MODE_PALETTE_CYCLE: animPaletteCycle();  break;
     case MODE_PALETTE_CHASE: animPaletteChase();  break;
-    default:                 animSolid();         break;
+    case MODE_TEMP_REACT:    animTempReact();     break;
+    case MODE_FAN_REACT:     animFanReact();      break;
+    default:                 fillRing(RgbColor(0,0,0)); break;
+  }
+  if (L.mode < MODE_COUNT && benchState != BENCH_RUN) statMode[L.mode].note(micros() - t0);
+}
+
+// Render the zones that are due into their layers (see ZoneRun). Each runs
+// on its own clock: frameDtMs is the time since that zone last rendered.
+static uint8_t renderZones(uint32_t nowUs) {
+  uint8_t n = 0;
+  for (uint8_t z=0; z<nZones; ++z) {
+    ZoneRun& r = zr[z];
+    const ZoneDef& d = zt.z[z];
+    r.dirty = false;
+    if (!r.len) continue;
+    const uint32_t baseUs = 1000000u / (RS.fps ? RS.fps : 60);
+    const uint32_t stepUs = d.fps ? 1000000u / d.fps : baseUs;
+    if (r.drawn) {
+      // Half a base frame of slack, so 30 fps on a 60 fps ring isn't 20.
+      const bool still = d.p.mode == MODE_SOLID;   // unchanged until RS moves
+      if (still ? r.rsSeen == rsSeq : (int32_t)(nowUs - r.nextUs) < -(int32_t)(baseUs / 2)) { ++r.skips; continue; }
+    }
+    RenderCfg p = RS;
+    applyStepOverlay(p, d.p);
+    const float    keepDt = frameDtMs;
+    const uint16_t keepN  = ringCount;
+    if (!r.drawn) { fxReset(r.L, d.p.mode, p); frameDtMs = 0.f; }
+    else {
+      r.L.p = p;
+      const uint32_t dt = nowUs - r.lastUs;
+      frameDtMs = (dt > 250000 ? 250000 : dt) / 1000.0f;
+    }
+    ringCount = r.len;
+    renderLayer(r.L);
+    ringCount = keepN; frameDtMs = keepDt;
+    // Keep the zone's cadence, but don't try to catch up after a stall.
+    r.nextUs = (r.drawn && (int32_t)(nowUs - r.nextUs) < (int32_t)stepUs) ? r.nextUs + stepUs : nowUs + stepUs;
+    r.lastUs = nowUs; r.rsSeen = rsSeq; r.drawn = true; r.dirty = true;
+    ++r.renders; ++n;
+  }
+  return n;
+}
+
+// fb = out + (in - out) * a, a = 0..256, in 8.8.
+static void blendLayers(const Rgb16* out, const Rgb16* in, uint32_t a) {
+  for (uint16_t i=0; i<ringCount; ++i) {
+    fb[i].R = (uint16_t)(out[i].R + ((((int32_t)in[i].R - out[i].R) * (int32_t)a) >> 8));
+    fb[i].G = (uint16_t)(out[i].G + ((((int32_t)in[i].G - out[i].G) * (int32_t)a) >> 8));
+    fb[i].B = (uint16_t)(out[i].B + ((((int32_t)in[i].B - out[i].B) * (int32_t)a) >> 8));
   }
+}
 
-  // Step advance
-  if (now - stepStart >= s.duration) {
-    stepStart = now;
-    idx++;
-    if (idx >= seq.size()) {
-      idx = CFG.customLoop ? 0 : (seq.size()-1);
+// -------------------- Realtime stream --------------------
+// Packets fill streamBack (any order, any offset); a push flips it into
+// streamFront under a short spinlock and the renderer shows streamFront
+// instead of the effect layers until the stream times out. Both are sized
+// to the ring by streamWrite()'s caller context (loop), not the renderer;
+// the pointers only change under streamMux.
+static Rgb16*       streamBack    = nullptr;
+static Rgb16*       streamFront   = nullptr;
+static uint16_t     streamCap     = 0;
+static portMUX_TYPE streamMux     = portMUX_INITIALIZER_UNLOCKED;
+static volatile uint32_t streamLastMs = 0;      // millis() of the last push
+static volatile bool     streamOn     = false;
+static uint32_t     streamPackets = 0, streamFrames = 0;
+
+static bool streamLive() {
+  if (!streamOn) return false;
+  if (millis() - streamLastMs < RGBCTRL_STREAM_TIMEOUT_MS) return true;
+  streamOn = false;                                // timed out: back to effects
+  return false;
+}
+
+// -------------------- OTA progress --------------------
+// While WiFiMgr flashes an update the ring shows a cheap progress bar (no
+// effect layers, capped frame rate) so flash writes get the CPU and bus.
+static const uint8_t  OTA_OFF = 0, OTA_RUN = 1, OTA_OK = 2, OTA_FAIL = 3;
+static const uint16_t OTA_PM_UNKNOWN   = 0xFFFF;   // image size not known yet
+static const uint32_t OTA_FAIL_HOLD_MS = 4000;     // red, then back to effects
+static volatile uint8_t  otaState    = OTA_OFF;
+static volatile uint16_t otaPermille = 0;
+static volatile uint32_t otaEndMs    = 0;
+
+// Fills fb; false once a failure has been shown long enough.
+static bool renderOta() {
+  const uint8_t  st  = otaState;
+  const uint32_t now = millis();
+  if (st == OTA_FAIL) {
+    if (now - otaEndMs >= OTA_FAIL_HOLD_MS) { otaState = OTA_OFF; return false; }
+    const Rgb16 c = ((now / 250) & 1) ? Rgb16{0xFFFF,0,0} : Rgb16{0x1000,0,0};
+    for (uint16_t i=0; i<ringCount; ++i) fb[i] = c;
+    return true;
+  }
+  if (st == OTA_OK) {
+    for (uint16_t i=0; i<ringCount; ++i) fb[i] = Rgb16{0,0xFFFF,0};
+    return true;
+  }
+  if (!ringCount) return true;
+
+  const uint16_t pm = otaPermille;
+  if (pm == OTA_PM_UNKNOWN) {                      // spinner: 1/8 of the ring
+    const uint16_t seg  = ringCount / 8 ? ringCount / 8 : 1;
+    const uint16_t head = (uint16_t)((now / 40) % ringCount);
+    for (uint16_t i=0; i<ringCount; ++i) {
+      const uint16_t d = (uint16_t)((head + ringCount - i) % ringCount);
+      fb[i] = d < seg ? Rgb16{0x1000,0x3000,0xFFFF} : Rgb16{0,0,0x0600};
     }
+    return true;
   }
+  const uint16_t lit = (uint16_t)(((uint32_t)ringCount * pm) / 1000);
+  const uint16_t dot = lit ? (uint16_t)((now / 30) % lit) : 0;   // runs along the bar
+  for (uint16_t i=0; i<ringCount; ++i) {
+    fb[i] = i >= lit  ? Rgb16{0,0,0x0600}
+          : i == dot ? Rgb16{0xFFFF,0xFFFF,0xFFFF}
+          :            Rgb16{0x1000,0x3000,0xFFFF};
+  }
+  return true;
+}
+
+// -------------------- Frame cost --------------------
+// Microseconds per stage for the last frame, plus smoothed (1/16 EMA) and
+// peak values. Served by /api/perf.
+struct PerfStat { uint32_t last, avg, peak; };
+static PerfStat perfFx, perfBlend, perfFrame;
+static uint8_t  perfLayers = 1;
+static inline void perfNote(PerfStat& s, uint32_t us) {
+  s.last = us;
+  s.avg  = s.avg ? (s.avg * 15 + us) / 16 : us;
+  if (us > s.peak) s.peak = us;
+}
+
+
+// -------------------- On-device benchmark --------------------
+// Renders every effect for benchFrames frames at several ring lengths on a
+// scratch layer, with default parameters, a fixed 60 fps clock and a fixed
+// PRNG seed, so the output only depends on the code. Reports CPU cycles and
+// ns per frame, heap taken during the run, and an FNV-1a checksum of the
+// last frame: compare checksums between builds (tools/bench.py keeps the
+// golden set) to catch visual changes, and cycles to catch slowdowns.
+static const uint32_t BENCH_SEED   = 0x58524742u;      // "XRGB"
+static const uint16_t BENCH_LENS[] = { 12, 50, 100, 200 };
+static const uint16_t BENCH_MAX    = 200;
+static void stageLock();
+static void stageUnlock();
+
+static uint32_t benchChecksum(const Rgb16* b, uint16_t n) {
+  uint32_t h = 2166136261u;
+  const uint8_t* p = (const uint8_t*)b;
+  for (size_t i=0; i<(size_t)n * sizeof(Rgb16); ++i) { h ^= p[i]; h *= 16777619u; }
+  return h;
+}
+
+// One (length, mode) case per call so a run never holds the render context
+// for long: with no render task that is loop(), and web commits, UDP and
+// SMBus keep being serviced between cases. The ring holds its last frame.
+static FxLayer*  benchL    = nullptr;      // scratch layer (~2 KB, only while running)
+static uint8_t*  benchMem  = nullptr;
+static RenderCfg benchP;
+static uint8_t   benchCase = 0;            // length index * MODE_CUSTOM + mode
+static String    benchAcc;                 // result being built (render context)
+
+static void benchFinish(const String& out) {
+  free(benchMem); free(benchL);
+  benchMem = nullptr; benchL = nullptr;
+  stageLock();
+  benchOut = out;
+  stageUnlock();
+  benchAcc = String();
+  benchState = BENCH_DONE;
+}
+
+static void benchStep() {
+  const uint32_t mhz = ESP.getCpuFreqMHz();
+  char line[96];
+  if (benchState == BENCH_REQ) {
+    benchL   = (FxLayer*)malloc(sizeof(FxLayer));
+    benchMem = (uint8_t*)malloc(layerBytes(BENCH_MAX));
+    if (!benchL || !benchMem) { benchFinish("{\"err\":\"no memory\"}"); return; }
+    memset(benchL, 0, sizeof(FxLayer));
+    layerBind(*benchL, benchMem, BENCH_MAX);
+    { const AppConfig defs; renderCfgFrom(defs, benchP); benchP.seqGen = 0; }
+    snprintf(line, sizeof(line), "{\"frames\":%u,\"mhz\":%lu,\"seed\":%lu,\"r\":[",
+             (unsigned)benchFrames, (unsigned long)mhz, (unsigned long)BENCH_SEED);
+    benchAcc   = line;
+    benchCase  = 0;
+    benchState = BENCH_RUN;
+  }
+
+  const uint8_t  nLens  = sizeof(BENCH_LENS) / sizeof(BENCH_LENS[0]);
+  const uint8_t  m      = benchCase % MODE_CUSTOM;
+  const uint16_t frames = benchFrames;
+  const uint16_t keepCount = ringCount;
+  const float    keepDt    = frameDtMs;
+  const bool     keepSync  = syncOn;
+  FxLayer* const keepFx    = FX;
+  FxLayer& B = *benchL;
+  syncOn    = false;
+  ringCount = BENCH_LENS[benchCase / MODE_CUSTOM];
+
+  fxReset(B, m, benchP);
+  B.st.rng  = BENCH_SEED;
+  frameDtMs = 1000.0f / 60.0f;
+  const uint32_t heap0 = ESP.getFreeHeap();
+  const uint32_t c0    = ESP.getCycleCount();
+  for (uint16_t f=0; f<frames; ++f) renderLayer(B);
+  const uint32_t cyc   = (ESP.getCycleCount() - c0) / frames;
+  const int32_t  taken = (int32_t)(heap0 - ESP.getFreeHeap());
+  // [mode, pixels, cycles/frame, ns/frame, heap bytes, "checksum"]
+  snprintf(line, sizeof(line), "%s[%u,%u,%lu,%lu,%ld,\"%08lx\"]", benchCase ? "," : "",
+           (unsigned)m, (unsigned)ringCount, (unsigned long)cyc,
+           (unsigned long)((uint64_t)cyc * 1000u / mhz), (long)taken,
+           (unsigned long)benchChecksum(B.buf, ringCount));
+  benchAcc += line;
+
+  ringCount = keepCount; frameDtMs = keepDt; syncOn = keepSync; FX = keepFx;
+  lastFrameUs = 0;                          // don't count the bench as a frame gap
+  if (++benchCase >= nLens * MODE_CUSTOM) benchFinish(benchAcc + "]}");
 }
 
 // -------------------- Frame selection --------------------
+// Real time since the previous frame; layer clocks advance from it.
+static void advanceClock() {
+  const uint32_t nowUs = micros();
+  uint32_t dtUs = lastFrameUs ? (nowUs - lastFrameUs) : 0;
+  lastFrameUs = nowUs;
+  if (dtUs > 250000) dtUs = 250000;          // long stall: don't leap ahead
+  frameDtMs = dtUs / 1000.0f;
+
+  // Achieved frame rate over ~1 s windows (x10 for one decimal).
+  ++statFpsFrames;
+  const uint32_t win = nowUs - statFpsWinUs;
+  if (win >= 1000000) {
+    statFpsX10 = (uint32_t)(((uint64_t)statFpsFrames * 10000000u) / win);
+    statFpsFrames = 0; statFpsWinUs = nowUs;
+  }
+}
+
+// Render-context only: the render task, or loop()/handlers when no task runs.
 static void renderFrame() {
-  // --- NEW: Master Off (force black regardless of mode) ---
-  if (CFG.masterOff) {
-    fillRing(RgbColor(0,0,0));
-    showRing();
+  if (benchState == BENCH_REQ || benchState == BENCH_RUN) {   // render context owns the layers
+    benchStep();
     return;
   }
 
-  switch (CFG.mode) {
-    case MODE_SOLID:         animSolid();         break;
-    case MODE_BREATHE:       animBreathe();       break;
-    case MODE_COLOR_WIPE:    animColorWipe();     break;
-    case MODE_LARSON:        animLarson();        break;
-    case MODE_RAINBOW:       animRainbow();       break;
-    case MODE_THEATER:       animTheater();       break;
-    case MODE_TWINKLE:       animTwinkle();       break;
-    case MODE_COMET:         animComet();         break;
-    case MODE_METEOR:        animMeteor();        break;
-    case MODE_CLOCK_SPIN:    animClockSpin();     break;
-    case MODE_PLASMA:        animPlasma();        break;
-    case MODE_FIRE:          animFire();          break;
+  const uint32_t t0 = micros();
+  syncSnapshot();
+  advanceClock();
 
-    case MODE_PALETTE_CYCLE: animPaletteCycle();  break;
-    case MODE_PALETTE_CHASE: animPaletteChase();  break;
+  // --- NEW: Master Off (force black regardless of mode) ---
+  if (RS.masterOff) {
+    for (uint16_t i=0; i<ringCount; ++i) fb[i] = Rgb16{0,0,0};
+    showRing(fb);
+    return;
+  }
+
+  if (otaState != OTA_OFF && renderOta()) {
+    showRing(fb);
+    statFrame.note(micros() - t0);
+    return;
+  }
 
-    // NEW: Custom playlist
-    case MODE_CUSTOM:        animCustom();        break;
+  // Live pixels from the network take over while the stream is fresh.
+  if (streamLive()) {
+    portENTER_CRITICAL(&streamMux);
+    const uint16_t n = ringCount < streamCap ? ringCount : streamCap;
+    if (n) memcpy(fb, streamFront, n * sizeof(Rgb16));
+    portEXIT_CRITICAL(&streamMux);
+    if (n < ringCount) memset(fb + n, 0, (ringCount - n) * sizeof(Rgb16));
+    showRing(fb);
+    perfLayers = 0;
+    perfNote(perfFrame, micros() - t0);
+    statFrame.note(micros() - t0);
+    return;
+  }
 
-    default: break;
+  if (RS.mode == MODE_CUSTOM) runPlaylist();
+  else                        runProgram(RS.mode, RS.mode, RS, RS.transition);
+
+  // Outgoing layer keeps animating under the incoming one until the fade ends.
+  FxLayer& in  = layers[curLayer];
+  FxLayer& out = layers[curLayer ^ 1];
+  uint32_t a = 256;
+  if (xfActive) {
+    const uint32_t el = millis() - xfStartMs;
+    if (el >= xfDurMs) xfActive = false;
+    else a = (el * 256u) / xfDurMs;
   }
-  showRing();
+
+  // The base effect still draws the whole ring (its geometry doesn't change
+  // with zones on top) unless the zones cover all of it.
+  const uint32_t t1 = micros();
+  const bool base = basePx != 0;
+  if (base && xfActive) renderLayer(out);
+  if (base)             renderLayer(in);
+  const uint8_t zoned = renderZones(t1);
+  const uint32_t t2 = micros();
+
+  const Rgb16* src = base ? in.buf : nullptr;
+  if (base && xfActive) { blendLayers(out.buf, in.buf, a); src = fb; }
+  const uint32_t t3 = micros();
+
+  showRing(src, true);
+
+  perfLayers = (base ? (xfActive ? 2 : 1) : 0) + zoned;
+  perfNote(perfFx,    t2 - t1);
+  perfNote(perfBlend, t3 - t2);
+  perfNote(perfFrame, micros() - t0);
+  statFrame.note(micros() - t0);
 }
 
 // -------------------- Persistence --------------------
-static const char* NVS_NS = "rgbctrl";
-static const char* NVS_KEY= "config";
+static const char* NVS_NS      = "rgbctrl";
+static const char* NVS_KEY_BIN = "cfgbin";   // CfgRecord
+static const char* NVS_KEY_SEQ = "cfgseq";   // SeqRecord header + PlayStep[]
+static const char* NVS_KEY_ZON = "cfgzone";  // SeqRecord header + ZoneDef[]
+static const char* NVS_KEY_OLD = "config";   // legacy JSON string (migrated on load)
+
+// Saved settings are a packed, versioned binary record with a CRC; the
+// compiled playlist is a separate blob so a normal save stays small. JSON is
+// only the wire format. Bump CFG_REC_VERSION when the layout changes and
+// migrate older records in loadConfig().
+static const uint16_t CFG_REC_MAGIC   = 0x5852;   // "XR"
+static const uint8_t  CFG_REC_VERSION = 1;
+enum : uint8_t {
+  CFGF_RESUME = 0x01, CFGF_CPU = 0x02, CFGF_FAN = 0x04,
+  CFGF_MASTER_OFF = 0x08, CFGF_LOOP = 0x10
+};
+struct __attribute__((packed)) CfgRecord {
+  uint16_t magic;
+  uint8_t  version;
+  uint8_t  size;                  // sizeof(CfgRecord) when written
+  uint16_t count[NUM_CH];
+  uint8_t  brightness, mode, speed, intensity, width, paletteCount, fps;
+  uint16_t transition;
+  uint32_t colorA, colorB, colorC, colorD;
+  uint8_t  flags;                 // CFGF_*
+  uint8_t  reverseMask;           // bit i = CH(i+1) reversed
+  uint32_t crc;                   // CRC-32 of everything above
+};
+struct __attribute__((packed)) SeqRecord {
+  uint16_t magic;
+  uint8_t  version;
+  uint8_t  n;                     // steps that follow
+  uint8_t  stepSize;              // sizeof(PlayStep) when written
+  uint32_t crc;                   // CRC-32 of the steps
+};
+
+static uint32_t crc32(const void* data, size_t len) {
+  const uint8_t* p = (const uint8_t*)data;
+  uint32_t c = 0xFFFFFFFFu;
+  while (len--) {
+    c ^= *p++;
+    for (uint8_t k=0; k<8; ++k) c = (c >> 1) ^ (0xEDB88320u & (0u - (c & 1u)));
+  }
+  return ~c;
+}
 
 static void defaults() { CFG = AppConfig(); }
 
-static String configToJson() {
+// Rebuild the customSeq JSON (for the UI/wire) from a compiled step table.
+// Written by hand: a JsonDocument for 32 steps would not fit on the stack.
+static void playlistToJson(const Playlist& pl, String& out) {
+  out = "";
+  out.reserve(2 + (size_t)pl.n * 176);
+  out += '[';
+  char tmp[48];
+  auto field = [&](const char* k, uint32_t v) {
+    snprintf(tmp, sizeof(tmp), ",\"%s\":%lu", k, (unsigned long)v);
+    out += tmp;
+  };
+  for (uint8_t i=0; i<pl.n; ++i) {
+    const PlayStep& s = pl.step[i];
+    if (i) out += ',';
+    snprintf(tmp, sizeof(tmp), "{\"mode\":%u,\"duration\":%u", s.mode, s.duration);
+    out += tmp;
+    if (s.transition != STEP_XF_DEFAULT) field("transition",   s.transition);
+    if (s.has & STEP_SPEED)              field("speed",        s.speed);
+    if (s.has & STEP_INTENSITY)          field("intensity",    s.intensity);
+    if (s.has & STEP_WIDTH)              field("width",        s.width);
+    if (s.has & STEP_PCNT)               field("paletteCount", s.pcount);
+    if (s.has & STEP_A)                  field("colorA",       s.colorA);
+    if (s.has & STEP_B)                  field("colorB",       s.colorB);
+    if (s.has & STEP_C)                  field("colorC",       s.colorC);
+    if (s.has & STEP_D)                  field("colorD",       s.colorD);
+    out += '}';
+  }
+  out += ']';
+}
+
+static String configToJson(const AppConfig& c) {
   StaticJsonDocument<2048> doc;
   JsonArray counts = doc.createNestedArray("count");
-  for (uint8_t i=0;i<NUM_CH;++i) counts.add(CFG.count[i]);
-  doc["brightness"]   = CFG.brightness;
-  doc["mode"]         = CFG.mode;
-  doc["speed"]        = CFG.speed;
-  doc["intensity"]    = CFG.intensity;
-  doc["width"]        = CFG.width;
-  doc["colorA"]       = CFG.colorA;
-  doc["colorB"]       = CFG.colorB;
-  doc["colorC"]       = CFG.colorC;
-  doc["colorD"]       = CFG.colorD;
-  doc["paletteCount"] = CFG.paletteCount;
-  doc["resumeOnBoot"] = CFG.resumeOnBoot;
-  doc["enableCpu"]    = CFG.enableCpu;
-  doc["enableFan"]    = CFG.enableFan;
+  for (uint8_t i=0;i<NUM_CH;++i) counts.add(c.count[i]);
+  doc["brightness"]   = c.brightness;
+  doc["mode"]         = c.mode;
+  doc["speed"]        = c.speed;
+  doc["intensity"]    = c.intensity;
+  doc["width"]        = c.width;
+  doc["fps"]          = c.fps;
+  doc["transition"]   = c.transition;
+  doc["colorA"]       = c.colorA;
+  doc["colorB"]       = c.colorB;
+  doc["colorC"]       = c.colorC;
+  doc["colorD"]       = c.colorD;
+  doc["paletteCount"] = c.paletteCount;
+  doc["resumeOnBoot"] = c.resumeOnBoot;
+  doc["enableCpu"]    = c.enableCpu;
+  doc["enableFan"]    = c.enableFan;
   doc["inPreview"]    = inPreview;
 
   // per-channel reverse
   JsonArray rev = doc.createNestedArray("reverse");
-  for (uint8_t i=0;i<NUM_CH;++i) rev.add(CFG.reverse[i]);
+  for (uint8_t i=0;i<NUM_CH;++i) rev.add(c.reverse[i]);
 
   // NEW fields
-  doc["masterOff"]   = CFG.masterOff;
-  doc["customSeq"]   = CFG.customSeq;
-  doc["customLoop"]  = CFG.customLoop;
+  doc["masterOff"]   = c.masterOff;
+  doc["customSeq"]   = c.customSeq.c_str();   // by pointer: not copied into the pool
+  doc["customLoop"]  = c.customLoop;
+  doc["zones"]       = c.zoneSpec.c_str();    // by pointer, like customSeq
 
   // Non-persistent display info
   doc["buildVersion"] = APP_VERSION;
+  doc["maxPerCh"]     = MAX_PER_CH;
   doc["copyright"]    = COPYRIGHT_TXT;
 
   String js; serializeJson(doc, js); return js;
 }
-static bool parseConfig(const String& body, AppConfig& out) {
-  StaticJsonDocument<2048> doc;
-  if (deserializeJson(doc, body)) return false;
-
+// Merge a parsed config object into `out` (fields not present are kept).
+// This is the single place JSON config fields are mapped onto AppConfig;
+// HTTP, UDP and NVS all come through here with an already-parsed document.
+static void configFromJson(JsonVariantConst doc, AppConfig& out) {
   if (doc.containsKey("count")) {
     for (uint8_t i=0;i<NUM_CH;++i) {
       uint16_t v = doc["count"][i].as<uint16_t>();
       if (v > MAX_PER_CH) v = MAX_PER_CH;
       out.count[i] = v;
     }
+    fitCounts(out.count);
   }
   if (doc.containsKey("brightness"))  out.brightness  = doc["brightness"].as<uint8_t>();
 
@@ -879,6 +2132,16 @@ static bool parseConfig(const String& body, AppConfig& out) {
     out.width = (uint8_t)w;
   }
 
+  if (doc.containsKey("fps")) {
+    int f = doc["fps"].as<int>();
+    if (f < FPS_MIN) f = FPS_MIN; if (f > FPS_MAX) f = FPS_MAX;
+    out.fps = (uint8_t)f;
+  }
+  if (doc.containsKey("transition")) {
+    int x = doc["transition"].as<int>();
+    if (x < 0) x = 0; if (x > XF_MAX_MS) x = XF_MAX_MS;
+    out.transition = (uint16_t)x;
+  }
   if (doc.containsKey("colorA"))      out.colorA      = doc["colorA"].as<uint32_t>();
   if (doc.containsKey("colorB"))      out.colorB      = doc["colorB"].as<uint32_t>();
   if (doc.containsKey("colorC"))      out.colorC      = doc["colorC"].as<uint32_t>();
@@ -905,758 +2168,685 @@ static bool parseConfig(const String& body, AppConfig& out) {
   // NEW fields
   if (doc.containsKey("masterOff"))   out.masterOff = doc["masterOff"].as<bool>();
   if (doc.containsKey("customLoop"))  out.customLoop= doc["customLoop"].as<bool>();
-  if (doc.containsKey("customSeq"))   out.customSeq = doc["customSeq"].as<const char*>();
+  if (doc.containsKey("customSeq")) {
+    // The UI resends the playlist with every slider move; only recompile
+    // (and reassign the String) when it actually changed.
+    const char* js = doc["customSeq"] | "";
+    if (strcmp(out.customSeq.c_str(), js)) {
+      out.customSeq = js;
+      compilePlaylist(js, out.steps);
+    }
+  }
+  if (doc.containsKey("zones")) {
+    const char* js = doc["zones"] | "";
+    if (strcmp(out.zoneSpec.c_str(), js)) {
+      out.zoneSpec = js;
+      compileZones(js, out.zones);
+    }
+  }
+}
 
+// One parse of a raw body into `out`. The document lives on the stack, so
+// nothing here touches the heap (beyond a changed customSeq).
+static bool parseConfig(const char* data, size_t len, AppConfig& out) {
+  StaticJsonDocument<2048> doc;
+  if (deserializeJson(doc, data, len)) return false;
+  if (!doc.is<JsonObject>()) return false;
+  configFromJson(doc.as<JsonVariantConst>(), out);
   return true;
 }
 static void applyConfig() {
-  rebuildRingMap();
-  for (uint8_t s=0; s<NUM_CH; ++s) STRIPS[s]->setBrightness(CFG.brightness);
-  lastAppliedBrightness = CFG.brightness;
+  publishConfig();
+}
+// Image of what's in NVS, so unchanged saves never touch flash.
+static CfgRecord savedRec;
+static uint32_t  savedSeqCrc = 0;
+static uint8_t   savedSeqN   = 0xFF;      // 0xFF = unknown (write next time)
+static uint32_t  savedZoneCrc = 0;
+static uint8_t   savedZoneN   = 0xFF;
+static uint32_t  nvsWrites = 0, nvsUnchanged = 0, nvsRequests = 0;
+
+static void saveConfig();
+
+static bool readRecord(AppConfig& out) {
+  CfgRecord r;
+  if (prefs.getBytesLength(NVS_KEY_BIN) != sizeof(r)) return false;
+  if (prefs.getBytes(NVS_KEY_BIN, &r, sizeof(r)) != sizeof(r)) return false;
+  if (r.magic != CFG_REC_MAGIC || r.version != CFG_REC_VERSION || r.size != sizeof(r)) return false;
+  if (r.crc != crc32(&r, offsetof(CfgRecord, crc))) return false;
+  savedRec = r;
+
+  for (uint8_t i=0;i<NUM_CH;++i) {
+    out.count[i]   = (r.count[i] > MAX_PER_CH) ? MAX_PER_CH : r.count[i];
+    out.reverse[i] = (r.reverseMask >> i) & 1;
+  }
+  fitCounts(out.count);
+  out.brightness   = r.brightness;
+  out.mode         = (r.mode < MODE_COUNT) ? r.mode : MODE_SOLID;
+  out.speed        = r.speed;
+  out.intensity    = r.intensity;
+  out.width        = r.width ? r.width : 1;
+  out.paletteCount = clampPaletteCount(r.paletteCount);
+  out.fps          = (r.fps < FPS_MIN) ? FPS_MIN : ((r.fps > FPS_MAX) ? FPS_MAX : r.fps);
+  out.transition   = (r.transition > XF_MAX_MS) ? XF_MAX_MS : r.transition;
+  out.colorA = r.colorA; out.colorB = r.colorB; out.colorC = r.colorC; out.colorD = r.colorD;
+  out.resumeOnBoot = r.flags & CFGF_RESUME;
+  out.enableCpu    = r.flags & CFGF_CPU;
+  out.enableFan    = r.flags & CFGF_FAN;
+  out.masterOff    = r.flags & CFGF_MASTER_OFF;
+  out.customLoop   = r.flags & CFGF_LOOP;
+  return true;
 }
+
+// A missing or damaged playlist blob just means "no playlist".
+static void readPlaylist(AppConfig& out) {
+  memset(&out.steps, 0, sizeof(out.steps));
+  SeqRecord h;
+  const size_t len = prefs.getBytesLength(NVS_KEY_SEQ);
+  if (len < sizeof(h) || len > sizeof(h) + sizeof(out.steps.step)) return;
+
+  uint8_t blob[sizeof(SeqRecord) + sizeof(out.steps.step)];
+  if (prefs.getBytes(NVS_KEY_SEQ, blob, len) != len) return;
+  memcpy(&h, blob, sizeof(h));
+  if (h.magic != CFG_REC_MAGIC || h.version != CFG_REC_VERSION ||
+      h.stepSize != sizeof(PlayStep) || h.n > MAX_STEPS ||
+      len != sizeof(h) + (size_t)h.n * sizeof(PlayStep)) return;
+  if (h.crc != crc32(blob + sizeof(h), len - sizeof(h))) return;
+
+  memcpy(out.steps.step, blob + sizeof(h), len - sizeof(h));
+  out.steps.n = h.n;
+  savedSeqN = h.n; savedSeqCrc = h.crc;
+  for (uint8_t i=0; i<h.n; ++i)                 // never trust stored modes
+    if (out.steps.step[i].mode == MODE_CUSTOM || out.steps.step[i].mode >= MODE_COUNT)
+      out.steps.step[i].mode = MODE_SOLID;
+}
+
+// Same for the zone table: missing or damaged means whole ring.
+static void readZones(AppConfig& out) {
+  memset(&out.zones, 0, sizeof(out.zones));
+  SeqRecord h;
+  const size_t len = prefs.getBytesLength(NVS_KEY_ZON);
+  if (len < sizeof(h) || len > sizeof(h) + sizeof(out.zones.z)) return;
+
+  uint8_t blob[sizeof(SeqRecord) + sizeof(out.zones.z)];
+  if (prefs.getBytes(NVS_KEY_ZON, blob, len) != len) return;
+  memcpy(&h, blob, sizeof(h));
+  if (h.magic != CFG_REC_MAGIC || h.version != CFG_REC_VERSION ||
+      h.stepSize != sizeof(ZoneDef) || h.n > MAX_ZONES ||
+      len != sizeof(h) + (size_t)h.n * sizeof(ZoneDef)) return;
+  if (h.crc != crc32(blob + sizeof(h), len - sizeof(h))) return;
+
+  memcpy(out.zones.z, blob + sizeof(h), len - sizeof(h));
+  out.zones.n = h.n;
+  savedZoneN = h.n; savedZoneCrc = h.crc;
+  for (uint8_t i=0; i<h.n; ++i) {               // never trust stored modes / channels
+    ZoneDef& z = out.zones.z[i];
+    if (z.p.mode == MODE_CUSTOM || z.p.mode >= MODE_COUNT) z.p.mode = MODE_SOLID;
+    if (z.nSpan > ZONE_SPANS) z.nSpan = ZONE_SPANS;
+    uint8_t keep = 0;                           // drop spans on channels we don't have
+    for (uint8_t k=0; k<z.nSpan; ++k) if (z.span[k].ch < NUM_CH) z.span[keep++] = z.span[k];
+    z.nSpan = keep;
+  }
+}
+
 static void loadConfig() {
+  AppConfig tmp;                                  // defaults for anything missing
   prefs.begin(NVS_NS, true);
-  String js = prefs.getString(NVS_KEY, "");
+  const bool ok = readRecord(tmp);
+  if (ok) { readPlaylist(tmp); readZones(tmp); }
+  String legacy;
+  if (!ok && prefs.isKey(NVS_KEY_OLD)) legacy = prefs.getString(NVS_KEY_OLD, "");
   prefs.end();
-  if (!js.length()) { defaults(); return; }
-
-  StaticJsonDocument<2048> doc;
-  if (!deserializeJson(doc, js)) {
-    AppConfig tmp = CFG;
-    if (doc.containsKey("count")) {
-      for (uint8_t i=0;i<NUM_CH;++i) {
-        uint16_t v = doc["count"][i].as<uint16_t>();
-        if (v > MAX_PER_CH) v = MAX_PER_CH;
-        tmp.count[i] = v;
-      }
-    }
-    if (doc.containsKey("brightness"))  tmp.brightness  = doc["brightness"].as<uint8_t>();
-    if (doc.containsKey("mode")) {
-      int m = doc["mode"].as<int>();
-      if (m < 0) m = 0;
-      if (m > (int)MODE_COUNT-1) m = MODE_COUNT-1;
-      tmp.mode = (uint8_t)m;
-    }
-    if (doc.containsKey("speed"))       tmp.speed       = doc["speed"].as<uint8_t>();
-    if (doc.containsKey("intensity"))   tmp.intensity   = doc["intensity"].as<uint8_t>();
-    if (doc.containsKey("width")) {
-      int w = doc["width"].as<int>();
-      if (w < 1) w = 1; if (w > 255) w = 255;
-      tmp.width = (uint8_t)w;
-    }
-    if (doc.containsKey("colorA"))      tmp.colorA      = doc["colorA"].as<uint32_t>();
-    if (doc.containsKey("colorB"))      tmp.colorB      = doc["colorB"].as<uint32_t>();
-    if (doc.containsKey("colorC"))      tmp.colorC      = doc["colorC"].as<uint32_t>();
-    if (doc.containsKey("colorD"))      tmp.colorD      = doc["colorD"].as<uint32_t>();
-    if (doc.containsKey("paletteCount")){
-      uint8_t pc = doc["paletteCount"].as<uint8_t>();
-      tmp.paletteCount = (pc < 1) ? 1 : ((pc > 4) ? 4 : pc);
-    }
-    if (doc.containsKey("resumeOnBoot"))tmp.resumeOnBoot= doc["resumeOnBoot"].as<bool>();
-    if (doc.containsKey("enableCpu"))   tmp.enableCpu   = doc["enableCpu"].as<bool>();
-    if (doc.containsKey("enableFan"))   tmp.enableFan   = doc["enableFan"].as<bool>();
-
-    // per-channel reverse
-    if (doc.containsKey("reverse")) {
-      for (uint8_t i=0;i<NUM_CH;++i) {
-        if (!doc["reverse"][i].isNull()) {
-          tmp.reverse[i] = doc["reverse"][i].as<bool>();
-        }
-      }
-    }
 
-    // NEW fields
-    if (doc.containsKey("masterOff"))   tmp.masterOff = doc["masterOff"].as<bool>();
-    if (doc.containsKey("customLoop"))  tmp.customLoop= doc["customLoop"].as<bool>();
-    if (doc.containsKey("customSeq"))   tmp.customSeq = doc["customSeq"].as<const char*>();
+  if (ok) {
+    playlistToJson(tmp.steps, tmp.customSeq);
+    zonesToJson(tmp.zones, tmp.zoneSpec);
+    CFG = tmp;
+    return;
+  }
 
+  // One-time migration from the JSON string older firmware stored.
+  if (legacy.length() && parseConfig(legacy.c_str(), legacy.length(), tmp)) {
     CFG = tmp;
+    saveConfig();
+    prefs.begin(NVS_NS, false); prefs.remove(NVS_KEY_OLD); prefs.end();
+    return;
   }
+  defaults();
 }
+
+static void buildRecord(const AppConfig& c, CfgRecord& r) {
+  memset(&r, 0, sizeof(r));
+  r.magic   = CFG_REC_MAGIC;
+  r.version = CFG_REC_VERSION;
+  r.size    = sizeof(r);
+  for (uint8_t i=0;i<NUM_CH;++i) {
+    r.count[i] = c.count[i];
+    if (c.reverse[i]) r.reverseMask |= (uint8_t)(1u << i);
+  }
+  r.brightness   = c.brightness;
+  r.mode         = c.mode;
+  r.speed        = c.speed;
+  r.intensity    = c.intensity;
+  r.width        = c.width;
+  r.paletteCount = c.paletteCount;
+  r.fps          = c.fps;
+  r.transition   = c.transition;
+  r.colorA = c.colorA; r.colorB = c.colorB; r.colorC = c.colorC; r.colorD = c.colorD;
+  r.flags = (c.resumeOnBoot ? CFGF_RESUME : 0) | (c.enableCpu ? CFGF_CPU : 0) |
+            (c.enableFan ? CFGF_FAN : 0)      | (c.masterOff ? CFGF_MASTER_OFF : 0) |
+            (c.customLoop ? CFGF_LOOP : 0);
+  r.crc = crc32(&r, offsetof(CfgRecord, crc));
+}
+
+// Write CFG to NVS now, skipping either blob if its bytes are unchanged.
+// Flash work, so only called from loop() (write-behind) or explicit flushes.
 static void saveConfig() {
-  StaticJsonDocument<2048> doc;
-  JsonArray counts = doc.createNestedArray("count");
-  for (uint8_t i=0;i<NUM_CH;++i) counts.add(CFG.count[i]);
-  doc["brightness"]   = CFG.brightness;
-  doc["mode"]         = CFG.mode;
-  doc["speed"]        = CFG.speed;
-  doc["intensity"]    = CFG.intensity;
-  doc["width"]        = CFG.width;
-  doc["colorA"]       = CFG.colorA;
-  doc["colorB"]       = CFG.colorB;
-  doc["colorC"]       = CFG.colorC;
-  doc["colorD"]       = CFG.colorD;
-  doc["paletteCount"] = CFG.paletteCount;
-  doc["resumeOnBoot"] = CFG.resumeOnBoot;
-  doc["enableCpu"]    = CFG.enableCpu;
-  doc["enableFan"]    = CFG.enableFan;
+  CfgRecord r;
+  static uint8_t blob[sizeof(SeqRecord) + sizeof(Playlist::step)];
+  static uint8_t zblob[sizeof(SeqRecord) + sizeof(ZoneTable::z)];
+  size_t blobLen, zblobLen;
+  SeqRecord h, zh;
+
+  stageLock();                                    // consistent view of CFG
+  buildRecord(CFG, r);
+  const size_t stepBytes = (size_t)CFG.steps.n * sizeof(PlayStep);
+  h.magic = CFG_REC_MAGIC; h.version = CFG_REC_VERSION;
+  h.n = CFG.steps.n; h.stepSize = sizeof(PlayStep);
+  h.crc = crc32(CFG.steps.step, stepBytes);
+  memcpy(blob, &h, sizeof(h));
+  memcpy(blob + sizeof(h), CFG.steps.step, stepBytes);
+  blobLen = sizeof(h) + stepBytes;
+  const size_t zoneBytes = (size_t)CFG.zones.n * sizeof(ZoneDef);
+  zh.magic = CFG_REC_MAGIC; zh.version = CFG_REC_VERSION;
+  zh.n = CFG.zones.n; zh.stepSize = sizeof(ZoneDef);
+  zh.crc = crc32(CFG.zones.z, zoneBytes);
+  memcpy(zblob, &zh, sizeof(zh));
+  memcpy(zblob + sizeof(zh), CFG.zones.z, zoneBytes);
+  zblobLen = sizeof(zh) + zoneBytes;
+  stageUnlock();
+
+  const bool recSame  = !memcmp(&r, &savedRec, sizeof(r));
+  const bool seqSame  = (h.n == savedSeqN && h.crc == savedSeqCrc);
+  const bool zoneSame = (zh.n == savedZoneN && zh.crc == savedZoneCrc);
+  if (recSame && seqSame && zoneSame) { ++nvsUnchanged; return; }
+
+  const uint32_t t0 = micros();
+  prefs.begin(NVS_NS, false);
+  if (!recSame)  prefs.putBytes(NVS_KEY_BIN, &r, sizeof(r));
+  if (!seqSame)  prefs.putBytes(NVS_KEY_SEQ, blob, blobLen);
+  if (!zoneSame) prefs.putBytes(NVS_KEY_ZON, zblob, zblobLen);
+  prefs.end();
+  statNvs.note(micros() - t0);
+  savedRec = r; savedSeqN = h.n; savedSeqCrc = h.crc;
+  savedZoneN = zh.n; savedZoneCrc = zh.crc;
+  ++nvsWrites;
+}
 
-  // per-channel reverse
-  JsonArray rev = doc.createNestedArray("reverse");
-  for (uint8_t i=0;i<NUM_CH;++i) rev.add(CFG.reverse[i]);
+// ---- Write-behind scheduling ----
+static volatile bool     saveDirty   = false;
+static volatile uint32_t saveFirstMs = 0;   // first request of this batch
+static volatile uint32_t saveLastMs  = 0;   // latest request
 
-  // NEW fields
-  doc["masterOff"]   = CFG.masterOff;
-  doc["customSeq"]   = CFG.customSeq;
-  doc["customLoop"]  = CFG.customLoop;
+static void requestSave() {
+  const uint32_t now = millis();
+  if (!saveDirty) saveFirstMs = now;
+  saveLastMs = now;
+  saveDirty  = true;
+  ++nvsRequests;
+}
+
+static void flushPendingSave() {
+  if (!saveDirty) return;
+  saveDirty = false;
+  saveConfig();
+}
 
-  String js; serializeJson(doc, js);
+static void serviceSave() {
+  if (!saveDirty || otaState == OTA_RUN) return;   // don't compete with OTA writes
+  const uint32_t now = millis();
+  if (now - saveLastMs  >= RGBCTRL_SAVE_DEBOUNCE_MS ||
+      now - saveFirstMs >= RGBCTRL_SAVE_MAX_DELAY_MS) flushPendingSave();
+}
+
+// Forget saved settings (all formats).
+static void eraseSaved() {
+  saveDirty = false;                      // reset supersedes a pending save
+  memset(&savedRec, 0, sizeof(savedRec)); savedSeqN = 0xFF; savedZoneN = 0xFF;
   prefs.begin(NVS_NS, false);
-  prefs.putString(NVS_KEY, js);
+  prefs.remove(NVS_KEY_BIN);
+  prefs.remove(NVS_KEY_SEQ);
+  prefs.remove(NVS_KEY_ZON);
+  prefs.remove(NVS_KEY_OLD);
   prefs.end();
 }
 
 // -------------------- Web UI --------------------
-static const char INDEX_HTML[] PROGMEM = R"HTML(
-<!doctype html><html><head>
-<meta charset="utf-8"/><meta name="viewport" content="width=device-width,initial-scale=1"/>
-<title>RGB Controller</title>
-<style>
-:root{--bg:#0f1115;--card:#161a22;--a:#6aa9ff;--t:#d6e1ff;--muted:#94a3b8;}
-*{box-sizing:border-box}body{margin:0;background:var(--bg);color:var(--t);font-family:Inter,system-ui,Segoe UI,Roboto,Arial}
-.container{max-width:980px;margin:24px auto;padding:0 16px}
-.card{background:var(--card);border-radius:16px;padding:18px 16px;box-shadow:0 6px 24px #0008;margin-bottom:18px}
-.row{display:grid;grid-template-columns:repeat(12,1fr);gap:12px}
-.h{font-size:22px;margin:0 0 12px}label{font-size:13px;color:var(--muted);display:block;margin-bottom:6px}
-input,select,button{width:100%;padding:10px 12px;border-radius:10px;border:1px solid #2a3142;background:#0b0e14;color:#d6e1ff}
-input[type=color]{padding:0;height:40px}button{background:#0f172a;border:1px solid #35425b;cursor:pointer}
-button.primary{background:#2563eb;border:0}
-.row>div{grid-column:span 12}@media(min-width:700px){.md-6{grid-column:span 6}.md-4{grid-column:span 4}.md-3{grid-column:span 3}}
-.badge{display:inline-block;background:#0b1220;border:1px solid #273657;color:#9ec1ff;padding:2px 8px;border-radius:999px;font-size:12px;margin-left:8px}
-.hint{color:#90a4c9;font-size:12px}
-.hide{display:none}
-.toggle{display:flex;align-items:center;gap:8px;flex-wrap:wrap}
-.footer{color:var(--muted);font-size:12px;text-align:center;padding:8px 0 24px}
-.sep{margin:0 8px}
-fieldset{border:1px solid #273657;border-radius:12px;padding:8px 10px}
-legend{padding:0 6px;color:#9ec1ff;font-size:12px}
-.inline{display:flex;gap:10px;flex-wrap:wrap}
-.inline>label{display:flex;align-items:center;gap:6px;margin:0}
-textarea{width:100%;min-height:120px;border-radius:10px;border:1px solid #2a3142;background:#0b0e14;color:#d6e1ff;padding:10px 12px}
-code{background:#0b1220;border:1px solid #273657;border-radius:6px;padding:2px 6px}
-/* Playlist editor */
-.plist{display:flex;flex-direction:column;gap:10px;margin-top:10px}
-.step{border:1px solid #273657;border-radius:10px;padding:10px;background:#0b1220}
-.step .grid{display:grid;grid-template-columns:repeat(12,1fr);gap:10px}
-.step .grid>div{grid-column:span 12}
-@media(min-width:900px){
-  .step .grid .col-2{grid-column:span 2}
-  .step .grid .col-3{grid-column:span 3}
-  .step .grid .col-4{grid-column:span 4}
-}
-.btn-row{display:flex;gap:8px;flex-wrap:wrap;margin-top:6px}
-.btn-xs{padding:6px 10px;border-radius:8px;border:1px solid #2a3142;background:#10182a;color:#d6e1ff;cursor:pointer}
-.btn-xs:hover{filter:brightness(1.1)}
-.muted{color:#90a4c9;font-size:12px}
-</style></head><body><div class="container">
-<div class="card">
-  <h2 class="h">RGB Controller (CH1–CH4)<span id="status" class="badge">loading…</span></h2>
-  <div class="row">
-    <div class="md-4"><label>Mode</label>
-      <select id="mode">
-        <option value="0">Solid</option>
-        <option value="1">Breathe</option>
-        <option value="2">Color Wipe</option>
-        <option value="3">Larson</option>
-        <option value="4">Rainbow</option>
-        <option value="5">Theater Chase</option>
-        <option value="6">Twinkle</option>
-        <option value="7">Comet</option>
-        <option value="8">Meteor</option>
-        <option value="9">Clock Spin</option>
-        <option value="10">Plasma</option>
-        <option value="11">Fire / Flicker</option>
-        <option value="12">Palette Cycle</option>
-        <option value="13">Palette Chase</option>
-        <option value="14">Custom (Playlist)</option>
-      </select>
-    </div>
-    <div class="md-4"><label>Brightness</label><input id="brightness" type="range" min="1" max="255"></div>
-    <div class="md-4"><label>Speed</label><input id="speed" type="range" min="0" max="255"></div>
-
-    <div class="md-3 opt opt-intensity"><label>Intensity</label><input id="intensity" type="range" min="0" max="255"></div>
-    <div class="md-3 opt opt-width"><label>Width / Gap</label><input id="width" type="range" min="1" max="20"></div>
-    <div class="md-3 opt opt-colorA"><label>Primary Color</label><input id="colorA" type="color"></div>
-    <div class="md-3 opt opt-colorB"><label>Secondary Color</label><input id="colorB" type="color"></div>
-    <div class="md-3 opt opt-colorC"><label>Color C</label><input id="colorC" type="color"></div>
-    <div class="md-3 opt opt-colorD"><label>Color D</label><input id="colorD" type="color"></div>
-    <div class="md-3 opt opt-palette"><label>Palette Size</label>
-      <select id="paletteCount">
-        <option value="1">1 color</option>
-        <option value="2" selected>2 colors</option>
-        <option value="3">3 colors</option>
-        <option value="4">4 colors</option>
-      </select>
-    </div>
-
-    <div class="md-3"><label>CH1 (Front) Count</label><input id="c0" type="number" min="0" max="50"></div>
-    <div class="md-3"><label>CH2 (Left) Count</label><input id="c1" type="number" min="0" max="50"></div>
-    <div class="md-3"><label>CH3 (Rear) Count</label><input id="c2" type="number" min="0" max="50"></div>
-    <div class="md-3"><label>CH4 (Right) Count</label><input id="c3" type="number" min="0" max="50"></div>
-
-    <!-- per-channel reverse toggles -->
-    <div class="md-12">
-      <fieldset>
-        <legend>Channel Direction</legend>
-        <div class="inline">
-          <label><input id="rev0" type="checkbox"> Reverse CH1 (Front)</label>
-          <label><input id="rev1" type="checkbox"> Reverse CH2 (Left)</label>
-          <label><input id="rev2" type="checkbox"> Reverse CH3 (Rear)</label>
-          <label><input id="rev3" type="checkbox"> Reverse CH4 (Right)</label>
-        </div>
-      </fieldset>
-    </div>
-
-    <!-- NEW: Master Off -->
-    <div class="md-12">
-      <fieldset>
-        <legend>Master</legend>
-        <div class="inline">
-          <label><input id="masterOff" type="checkbox"> Master Off (blank all channels)</label>
-        </div>
-      </fieldset>
-    </div>
-
-    <!-- NEW: Custom Playlist Editor -->
-    <div class="md-12 opt opt-custom hide">
-      <fieldset>
-        <legend>Custom Playlist</legend>
-        <div class="inline" style="align-items:center">
-          <label><input id="customLoop" type="checkbox" checked> Loop playlist</label>
-        </div>
-        <label>Steps (JSON array)</label>
-        <textarea id="customSeq" rows="8"></textarea>
-        <div class="hint">
-          Build from existing modes for stability. Example:
-          <code>[{"mode":0,"duration":1000,"colorA":16711680},{"mode":7,"duration":1200,"speed":200,"width":6},{"mode":12,"duration":1500,"paletteCount":3}]</code>
-        </div>
-      </fieldset>
-    </div>
-
-    <!-- NEW: Custom Playlist Editor (Visual) -->
-    <div class="md-12 opt opt-custom hide">
-      <fieldset>
-        <legend>Custom Playlist</legend>
-        <div class="inline" style="align-items:center">
-          <label><input id="customLoop" type="checkbox" checked> Loop playlist</label>
-          <button id="addStep" type="button" class="btn-xs">Add Step</button>
-          <button id="clearSteps" type="button" class="btn-xs">Clear</button>
-          <span class="muted">Drag not required: use Up/Down per step</span>
-        </div>
-        <div id="plist" class="plist"></div>
-        <!-- Keep a hidden field with JSON for firmware compatibility -->
-        <textarea id="customSeq" class="hide" rows="1"></textarea>
-        <div class="hint">
-          The editor builds the playlist for you. Each step plays one built-in mode for a duration.
-        </div>
-      </fieldset>
-    </div>
-
-    <div class="md-6"><label>Resume last mode on boot</label>
-      <select id="resume"><option value="true">Yes</option><option value="false">No</option></select>
-    </div>
-
-    <div class="md-6"><label>Xbox SMBus LEDs</label>
-      <div class="toggle">
-        <input id="smbusCpu" type="checkbox"> <span>Enable CPU temp LEDs (CH5)</span>
-      </div>
-      <div class="toggle">
-        <input id="smbusFan" type="checkbox"> <span>Enable Fan speed LEDs (CH6)</span>
-      </div>
-      <span class="hint">Disable to avoid SMBus polling by the other module.</span>
-    </div>
-
-    <div class="md-6"><button class="primary" id="save">Save</button></div>
-    <div class="md-6"><button id="revert">Reload</button></div>
-    <div class="md-6"><button id="reset">Reset Defaults</button></div>
-    <div class="md-12"><span class="hint">All changes preview live. Click Save to persist to flash.</span></div>
-  </div>
-</div>
-
-<!-- Footer (always visible) -->
-<div id="footer" class="footer">
-  <span id="cpy">%%COPYRIGHT%%</span><span class="sep">•</span><span id="ver">v%%VERSION%%</span>
-</div>
-
-</div>
-<script>
-const el=id=>document.getElementById(id);
-const hex24=n=>'#'+('000000'+n.toString(16)).slice(-6);
-const to24=hex=>parseInt(hex.replace('#',''),16);
-
-// ---- Injected at render time so controls are filled immediately ----
-const BOOT = %%BOOTJSON%%;
-
-let state=null, syncing=false;
-
-
-// Labels for per-step Mode selector (indexes must match main Mode list)
-const MODE_LABELS=["Solid","Breathe","Color Wipe","Larson","Rainbow","Theater Chase","Twinkle","Comet","Meteor","Clock Spin","Plasma","Fire / Flicker","Palette Cycle","Palette Chase"];
-
-function showOptsFor(mode){
-  const vis = {
-    colorA:   [0,1,2,3,4,5,6,7,8,9,10,11,12,13,14],
-    colorB:   [8,9,10,12,13,14],
-    colorC:   [12,13,14],
-    colorD:   [12,13,14],
-    palette:  [12,13,14],
-    width:    [3,5,7,8,9,13,14],        // Palette Chase & Custom
-    intensity:[3,5,6,7,8,11,12,13,14],  // palette blend / soft edges
-    custom:   [14]
-  };
+// The page source is web/config.html; tools/webgz.py compresses it into
+// web_config.h. It carries no server-side placeholders: the API base comes
+// from location.pathname and the config from /api/ledconfig.
+
+// -------------------- Render task --------------------
+static TaskHandle_t renderTaskHandle = nullptr;
+
+static inline uint32_t framePeriodUs() {
+  uint8_t f = RS.fps;
+  if (f < FPS_MIN) f = FPS_MIN; if (f > FPS_MAX) f = FPS_MAX;
+  if (otaState != OTA_OFF && f > RGBCTRL_OTA_FPS) f = RGBCTRL_OTA_FPS;
+  return 1000000UL / f;
+}
+
+// Fixed-rate scheduler: true when the next frame slot has arrived. Slots are
+// absolute, so pacing doesn't drift; if we fall a full period behind the
+// schedule restarts from now instead of bursting to catch up (the animation
+// clock is time-driven, so dropped frames don't slow effects down).
+static bool frameDue(uint32_t nowUs) {
+  const uint32_t period = framePeriodUs();
+  if ((int32_t)(nowUs - nextFrameUs) < 0) return false;
+  if (nextFrameUs) statJitter.note(nowUs - nextFrameUs);   // 0 = first frame
+  nextFrameUs += period;
+  if ((int32_t)(nowUs - nextFrameUs) >= 0) nextFrameUs = nowUs + period;
+  return true;
+}
 
-  const on = k => (vis[k]||[]).includes(mode);
-  const toggle = (cls, yes)=>document.querySelectorAll(cls).forEach(n=>n.classList.toggle('hide',!yes));
-
-  // base visibility by mode
-  toggle('.opt-colorA', on('colorA'));
-  toggle('.opt-colorB', on('colorB'));
-  toggle('.opt-colorC', on('colorC'));
-  toggle('.opt-colorD', on('colorD'));
-  toggle('.opt-palette', on('palette'));
-  toggle('.opt-width',  on('width'));
-  toggle('.opt-intensity', on('intensity'));
-  toggle('.opt-custom', on('custom'));
-
-  // further trim Color C/D by palette size when palette modes are active
-  if (on('palette')) {
-    const pc = +document.getElementById('paletteCount').value || 2;
-    document.querySelectorAll('.opt-colorC').forEach(n=>n.classList.toggle('hide', pc < 3));
-    document.querySelectorAll('.opt-colorD').forEach(n=>n.classList.toggle('hide', pc < 4));
-  } else {
-    document.querySelectorAll('.opt-colorC').forEach(n=>n.classList.add('hide'));
-    document.querySelectorAll('.opt-colorD').forEach(n=>n.classList.add('hide'));
-  }
-}
-
-function fillForm(s){
-  el('mode').value      = s.mode;
-  el('brightness').value= s.brightness;
-  el('speed').value     = s.speed;
-  el('intensity').value = s.intensity;
-  el('width').value     = s.width;
-  el('colorA').value    = hex24(s.colorA);
-  el('colorB').value    = hex24(s.colorB);
-  el('colorC').value    = hex24(s.colorC || 0);
-  el('colorD').value    = hex24(s.colorD || 0);
-  el('paletteCount').value = s.paletteCount || 2;
-  for(let i=0;i<4;i++) el('c'+i).value = s.count[i];
-
-  // reverse flags
-  const rev = s.reverse || [false,false,false,false];
-  for(let i=0;i<4;i++) { const n = el('rev'+i); if (n) n.checked = !!rev[i]; }
-
-  // NEW
-  el('masterOff').checked = !!s.masterOff;
-  el('customLoop').checked = !!s.customLoop;
-  el('customSeq').value = (s.customSeq && String(s.customSeq).length) ? s.customSeq : "[]";
-
-  el('resume').value    = s.resumeOnBoot ? 'true' : 'false';
-  el('smbusCpu').checked= !!s.enableCpu;
-  el('smbusFan').checked= !!s.enableFan;
-
-  // footer text (always shown)
-  el('ver').textContent = 'v' + (s.buildVersion || '—');
-  el('cpy').textContent = s.copyright || '© Darkone Customs 2025';
-
-  showOptsFor(s.mode|0);
-
-  // Build the visual playlist from saved JSON
-  try {
-    const steps = JSON.parse(s.customSeq || "[]");
-    setPlaylistUI(Array.isArray(steps) ? steps : []);
-  } catch(_e){
-    setPlaylistUI([]);
-  }
-}
-
-function gather(){
-  const reverse = [0,1,2,3].map(i => !!el('rev'+i).checked);
-  return {
-    mode:+el('mode').value,
-    brightness:+el('brightness').value,
-    speed:+el('speed').value,
-    intensity:+el('intensity').value,
-    width:+el('width').value,
-    colorA:to24(el('colorA').value),
-    colorB:to24(el('colorB').value),
-    colorC:to24(el('colorC').value),
-    colorD:to24(el('colorD').value),
-    paletteCount:+el('paletteCount').value,
-    count:[+el('c0').value,+el('c1').value,+el('c2').value,+el('c3').value],
-    reverse:reverse,
-    resumeOnBoot:(el('resume').value==='true'),
-    enableCpu:el('smbusCpu').checked,
-    enableFan:el('smbusFan').checked,
-
-    // NEW
-    masterOff: el('masterOff').checked,
-    customLoop: el('customLoop').checked,
-    customSeq: (el('customSeq').value || "[]"), // kept in sync by the visual editor
-  };
+static void renderTaskMain(void*) {
+  for (;;) {
+    const int32_t waitUs = (int32_t)(nextFrameUs - micros());
+    if (waitUs > 0) {
+      const TickType_t ticks = pdMS_TO_TICKS((waitUs + 999) / 1000);
+      if (ulTaskNotifyTake(pdTRUE, ticks ? ticks : 1)) {
+        renderFrame();           // kicked by a config change: show it now
+        continue;
+      }
+    }
+    if (frameDue(micros())) renderFrame();
+  }
 }
 
-async function load(){
-  syncing=true;
-  // 1) Fill instantly from injected JSON (last-saved prefs)
-  state = BOOT || {};
-  fillForm(state);
-  el('status').textContent='ready';
-
-  // 2) Also fetch live from API (in case config changed elsewhere)
-  try{
-    const j = await fetch('%%BASE%%/api/ledconfig').then(r=>r.json());
-    state = j; fillForm(state);
-  }catch(e){
-    console.log('load config fetch failed', e);
-  }
-  syncing=false;
-}
-
-async function preview(){
-  if(syncing) return;
-  const res = await fetch('%%BASE%%/api/ledpreview',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(gather())});
-  el('status').textContent = res.ok ? 'live' : 'error';
-}
-async function save(){
-  const res = await fetch('%%BASE%%/api/ledsave',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(gather())});
-  el('status').textContent = res.ok ? 'saved' : 'error';
-}
-async function resetDefaults(){
-  const res = await fetch('%%BASE%%/api/ledreset',{method:'POST'});
-  el('status').textContent = res.ok ? 'reset' : 'error';
-  load();
-}
-
-// ---- Event binding (fix: use 'change' for selects) ----
-function bind(id, handler) {
-  const n = document.getElementById(id);
-  if (!n) return;
-  const ev = (n.tagName === 'SELECT' || n.type === 'checkbox') ? 'change' : 'input';
-  n.addEventListener(ev, handler);
-}
-
-// On mode change: update option visibility then preview
-bind('mode', () => {
-  showOptsFor(+document.getElementById('mode').value);
-  preview();
-});
-
-// Palette size can change which color pickers are shown (C/D)
-bind('paletteCount', () => {
-  showOptsFor(+document.getElementById('mode').value);
-  preview();
-});
-
-// Live preview for the rest
-['brightness','speed','intensity','width','colorA','colorB','colorC','colorD','resume','smbusCpu','smbusFan',
- 'rev0','rev1','rev2','rev3','c0','c1','c2','c3',
- 'masterOff','customLoop']
-  .forEach(id => bind(id, preview));
-
-// ------------ Custom Playlist UI (visual builder) ------------
-function stepTemplate() {
-  // A row with all fields the firmware understands; we always include values for predictability
-  return `
-    <div class="step">
-      <div class="grid">
-        <div class="col-3">
-          <label>Mode</label>
-          <select data-f="mode" class="mode-select"></select>
-        </div>
-        <div class="col-3">
-          <label>Duration (ms)</label>
-          <input data-f="dur" class="num" type="number" min="1" max="60000" value="1000">
-        </div>
-        <div class="col-2">
-          <label>Speed</label>
-          <input data-f="speed" class="rng" type="range" min="0" max="255" value="128">
-        </div>
-        <div class="col-2">
-          <label>Intensity</label>
-          <input data-f="intensity" class="rng" type="range" min="0" max="255" value="128">
-        </div>
-        <div class="col-2">
-          <label>Width</label>
-          <input data-f="width" class="rng" type="range" min="1" max="20" value="4">
-        </div>
-
-        <div class="col-2">
-          <label>Palette Size</label>
-          <select data-f="pcnt">
-            <option value="1">1</option>
-            <option value="2" selected>2</option>
-            <option value="3">3</option>
-            <option value="4">4</option>
-          </select>
-        </div>
-
-        <div class="col-3"><label>Color A</label><input data-f="a" class="clr" type="color" value="#ff0000"></div>
-        <div class="col-3"><label>Color B</label><input data-f="b" class="clr" type="color" value="#ffa000"></div>
-        <div class="col-3"><label>Color C</label><input data-f="c" class="clr" type="color" value="#00ff00"></div>
-        <div class="col-3"><label>Color D</label><input data-f="d" class="clr" type="color" value="#0000ff"></div>
-      </div>
-      <div class="btn-row">
-        <button type="button" data-act="up" class="btn-xs">↑ Up</button>
-        <button type="button" data-act="down" class="btn-xs">↓ Down</button>
-        <button type="button" data-act="dup" class="btn-xs">Duplicate</button>
-        <button type="button" data-act="del" class="btn-xs">Delete</button>
-      </div>
-    </div>
-  `;
-}
-
-function makeModeOptions(sel){
-  sel.innerHTML = MODE_LABELS.map((label, i) => `<option value="${i}">${label}</option>`).join('');
-  // Note: mode 14 = Custom is not for steps; we leave it out on purpose
-}
-
-function rowToStep(row){
-  const q = s => row.querySelector(s);
-  return {
-    mode: +q('[data-f=mode]').value,
-    duration: Math.max(1, Math.min(60000, +q('[data-f=dur]').value || 1000)),
-    speed: +q('[data-f=speed]').value,
-    intensity: +q('[data-f=intensity]').value,
-    width: +q('[data-f=width]').value,
-    paletteCount: +q('[data-f=pcnt]').value,
-    colorA: to24(q('[data-f=a]').value),
-    colorB: to24(q('[data-f=b]').value),
-    colorC: to24(q('[data-f=c]').value),
-    colorD: to24(q('[data-f=d]').value),
-  };
+// Show a config change right away. With the render task running this only
+// wakes the task, so CFG writers never touch the framebuffer or strips.
+static void kickRender() {
+  if (renderTaskHandle) xTaskNotifyGive(renderTaskHandle);
+  else renderFrame();
+}
+
+// -------------------- Config apply (single parse) --------------------
+// Control messages arrive already parsed and are merged into a staging copy,
+// then committed to CFG. The staging copy is reused, so its String keeps its
+// buffer between messages. Web handlers run on the async_tcp task and UDP on
+// loop(); stageMutex keeps them from interleaving.
+static AppConfig         stageCfg;
+static bool              stageValid = false;
+static bool              stageSave  = false;
+static SemaphoreHandle_t stageMutex = nullptr;
+
+static void stageLock()   { if (stageMutex) xSemaphoreTake(stageMutex, portMAX_DELAY); }
+static void stageUnlock() { if (stageMutex) xSemaphoreGive(stageMutex); }
+
+// Config generation: bumped for every accepted change (staged or direct), so
+// a client can send only changed fields against the generation it last saw
+// and ask for the config only if it moved on. Seeded randomly at boot so a
+// generation from before a reboot never matches. 0 means "any generation".
+static uint32_t cfgGen = 1;
+
+// Caller holds the stage lock.
+static void bumpGenLocked() { if (++cfgGen == 0) cfgGen = 1; }
+static void bumpGen() { stageLock(); bumpGenLocked(); stageUnlock(); }
+
+// Caller holds the stage lock.
+static void stageMerge(JsonVariantConst cfg, bool save) {
+  if (!stageValid) { stageCfg = CFG; stageValid = true; stageSave = false; }
+  configFromJson(cfg, stageCfg);
+  stageSave = stageSave || save;
+  bumpGenLocked();
+}
+
+// Caller holds the stage lock. A non-zero baseGen must be the current
+// generation or nothing is merged; gen gets the generation after the call.
+static bool stageMergeIf(JsonVariantConst cfg, bool save, uint32_t baseGen, uint32_t& gen) {
+  const bool fresh = !baseGen || baseGen == cfgGen;
+  if (fresh) stageMerge(cfg, save);
+  gen = cfgGen;
+  return fresh;
+}
+
+// The config as the next frame will see it (staged changes included), with
+// the generation it belongs to.
+static String liveConfigJson(uint32_t& gen) {
+  stageLock();
+  String js = configToJson(stageValid ? stageCfg : CFG);
+  gen = cfgGen;
+  stageUnlock();
+  return js;
+}
+static bool stageCommit() {
+  if (!stageValid) return false;
+  CFG = stageCfg;
+  stageValid = false;
+  inPreview = !stageSave;
+  applyConfig();
+  if (stageSave) requestSave();           // written later from loop()
+  return true;
 }
 
-function applyStepToRow(row, s){
-  const q = sel => row.querySelector(sel);
-  makeModeOptions(q('[data-f=mode]'));
-  q('[data-f=mode]').value = (s.mode ?? 0);
-  q('[data-f=dur]').value = (s.duration ?? 1000);
-  q('[data-f=speed]').value = (s.speed ?? 128);
-  q('[data-f=intensity]').value = (s.intensity ?? 128);
-  q('[data-f=width]').value = (s.width ?? 4);
-  q('[data-f=pcnt]').value = (s.paletteCount ?? 2);
-  q('[data-f=a]').value = hex24(s.colorA ?? 0xFF0000);
-  q('[data-f=b]').value = hex24(s.colorB ?? 0xFFA000);
-  q('[data-f=c]').value = hex24(s.colorC ?? 0x00FF00);
-  q('[data-f=d]').value = hex24(s.colorD ?? 0x0000FF);
-}
-
-function syncHiddenFromUI(){
-  const rows = Array.from(document.querySelectorAll('#plist .step'));
-  const steps = rows.map(rowToStep);
-  el('customSeq').value = JSON.stringify(steps);
-}
-
-function attachRowActions(row){
-  const plist = el('plist');
-  const act = (sel, fn) => row.querySelector(sel).addEventListener('click', fn);
-  act('[data-act=del]', () => { row.remove(); syncHiddenFromUI(); preview(); });
-  act('[data-act=dup]', () => {
-    const clone = row.cloneNode(true);
-    plist.insertBefore(clone, row.nextSibling);
-    // reattach listeners and keep values
-    attachRowEvents(clone);
-    syncHiddenFromUI(); preview();
-  });
-  act('[data-act=up]', () => {
-    const prev = row.previousElementSibling;
-    if (prev) plist.insertBefore(row, prev);
-    syncHiddenFromUI(); preview();
-  });
-  act('[data-act=down]', () => {
-    const next = row.nextElementSibling;
-    if (next) plist.insertBefore(next, row);
-    syncHiddenFromUI(); preview();
-  });
+static bool applyCfg(JsonVariantConst cfg, bool save) {
+  if (!cfg.is<JsonObjectConst>()) return false;
+  stageLock();
+  stageMerge(cfg, save);
+  stageCommit();
+  stageUnlock();
+  kickRender();
+  return true;
 }
 
-function attachRowEvents(row){
-  // inputs that affect JSON/preview
-  row.querySelectorAll('input,select').forEach(n => {
-    const ev = (n.tagName === 'SELECT' || n.type === 'checkbox') ? 'change' : 'input';
-    n.addEventListener(ev, () => { syncHiddenFromUI(); preview(); });
-  });
-  attachRowActions(row);
-}
-
-function addStepRow(step){
-  const wrap = document.createElement('div');
-  wrap.innerHTML = stepTemplate();
-  const row = wrap.firstElementChild;
-  applyStepToRow(row, step || {});
-  el('plist').appendChild(row);
-  attachRowEvents(row);
-}
-
-function setPlaylistUI(steps){
-  const plist = el('plist');
-  plist.innerHTML = '';
-  const arr = (Array.isArray(steps) && steps.length) ? steps : [ { mode:0, duration:1000 } ];
-  arr.forEach(s => addStepRow(s));
-  syncHiddenFromUI();
-}
-
-// Add/Clear buttons for playlist
-document.addEventListener('click', (e) => {
-  if (e.target && e.target.id === 'addStep') {
-    // Seed new step from current global controls so it feels intuitive
-    const step = {
-      mode: 0,
-      duration: 1000,
-      speed: +el('speed').value || 128,
-      intensity: +el('intensity').value || 128,
-      width: +el('width').value || 4,
-      paletteCount: +el('paletteCount').value || 2,
-      colorA: to24(el('colorA').value),
-      colorB: to24(el('colorB').value),
-      colorC: to24(el('colorC').value),
-      colorD: to24(el('colorD').value),
-    };
-    addStepRow(step);
-    syncHiddenFromUI(); preview();
+// Web handlers (async_tcp task) only stage; loop() commits, so CFG and the
+// strips stay on one thread and a burst of changes applies once.
+static std::atomic<bool> commitReq{false};
+static std::atomic<bool> resetReq{false};
+
+static bool webStage(JsonVariantConst cfg, bool save) {
+  if (!cfg.is<JsonObjectConst>()) return false;
+  stageLock();
+  stageMerge(cfg, save);
+  stageUnlock();
+  commitReq.store(true);
+  return true;
+}
+
+// Conditional stage for PATCH: false (nothing staged) if baseGen is stale.
+static bool patchCfg(JsonVariantConst cfg, bool save, uint32_t baseGen, uint32_t& gen) {
+  stageLock();
+  const bool ok = stageMergeIf(cfg, save, baseGen, gen);
+  stageUnlock();
+  if (ok) commitReq.store(true);
+  return ok;
+}
+
+// Generation from an ETag-style header value: "123", "g123" or W/"g123".
+static uint32_t genFromTag(const String& v) {
+  const char* p = v.c_str();
+  while (*p && (*p < '0' || *p > '9')) ++p;
+  return (uint32_t)strtoul(p, nullptr, 10);
+}
+static String genTag(uint32_t gen) { return "\"g" + String(gen) + "\""; }
+
+// Body handler for /api/ledpreview and /api/ledsave. The usual single-chunk
+// body is parsed straight out of the TCP buffer; a body split over several
+// chunks is gathered into one allocation that the request frees.
+static const size_t CFG_BODY_MAX = 4096;
+static void onCfgBody(AsyncWebServerRequest* req, uint8_t* data, size_t len,
+                      size_t index, size_t total, bool save, bool patch = false) {
+  if (total > CFG_BODY_MAX) {
+    if (index == 0) req->send(413, "text/plain", "Too large");
+    return;
+  }
+  const char* src = (const char*)data;
+  if (index != 0 || len != total) {
+    if (index == 0) {
+      req->_tempObject = malloc(total);
+      if (!req->_tempObject) { req->send(500, "text/plain", "No memory"); return; }
+    }
+    char* acc = (char*)req->_tempObject;
+    if (!acc) return;
+    memcpy(acc + index, data, len);
+    if (index + len < total) return;
+    src = acc;
+  }
+
+  StaticJsonDocument<2048> doc;
+  if (patch) {
+    // PATCH: changed fields only; base generation from If-Match or ?gen=
+    uint32_t base = 0, gen = 0;
+    if (req->hasHeader("If-Match"))  base = genFromTag(req->getHeader("If-Match")->value());
+    else if (req->hasParam("gen"))   base = (uint32_t)strtoul(req->getParam("gen")->value().c_str(), nullptr, 10);
+    if (deserializeJson(doc, src, total) || !doc.is<JsonObjectConst>()) {
+      req->send(400, "text/plain", "Bad JSON");
+      return;
+    }
+    const bool ok = patchCfg(doc.as<JsonVariantConst>(), save, base, gen);
+    AsyncWebServerResponse* resp = req->beginResponse(ok ? 200 : 412, "application/json",
+      String(ok ? "{\"ok\":true" : "{\"ok\":false,\"err\":\"stale\"") + ",\"gen\":" + String(gen) + "}");
+    resp->addHeader("ETag", genTag(gen));
+    req->send(resp);
+    return;
   }
-  if (e.target && e.target.id === 'clearSteps') {
-    el('plist').innerHTML = '';
-    setPlaylistUI([]); // inserts one default step
-    syncHiddenFromUI(); preview();
+  if (deserializeJson(doc, src, total) || !webStage(doc.as<JsonVariantConst>(), save)) {
+    req->send(400, "text/plain", "Bad JSON");
+    return;
   }
-});
+  req->send(200, "application/json", "{\"ok\":true}");
+}
 
+// -------------------- Live control (WebSocket) --------------------
+// <base>/ws carries small JSON deltas instead of a POST per change:
+//   {"op":"patch","cfg":{changed fields},"gen":N,"save":false}
+//     -> {"op":"ack","ok":true,"gen":N}  (or "ok":false,"err":"stale")
+//   {"op":"get"} -> {"op":"config","gen":N,"cfg":{...}}
+// Patches are staged like HTTP/UDP and committed from loop(). Any config
+// change, from any source, is pushed to every client as an "config" message.
+static AsyncWebSocket* ws = nullptr;
+static uint32_t wsSentGen = 0, wsSentMs = 0, wsCleanMs = 0;
 
-// Buttons
-document.getElementById('save').addEventListener('click',save);
-document.getElementById('revert').addEventListener('click',load);
-document.getElementById('reset').addEventListener('click',resetDefaults);
+static String wsConfigMsg() {
+  uint32_t gen;
+  String js = liveConfigJson(gen);
+  return "{\"op\":\"config\",\"gen\":" + String(gen) + ",\"cfg\":" + js + "}";
+}
+
+static void wsOnEvent(AsyncWebSocket*, AsyncWebSocketClient* c, AwsEventType type,
+                      void* arg, uint8_t* data, size_t len) {
+  if (type == WS_EVT_CONNECT) { c->text(wsConfigMsg()); return; }
+  if (type != WS_EVT_DATA) return;
+
+  // Control messages are small: single-frame text only
+  const AwsFrameInfo* fi = (const AwsFrameInfo*)arg;
+  if (!fi->final || fi->index != 0 || fi->len != len || fi->opcode != WS_TEXT) return;
 
-load();
-</script></body></html>
-)HTML";
+  StaticJsonDocument<2048> doc;
+  if (deserializeJson(doc, (const char*)data, len)) { c->text("{\"op\":\"err\",\"err\":\"bad json\"}"); return; }
+  const char* op = doc["op"] | "";
+  if (!strcmp(op, "get")) { c->text(wsConfigMsg()); return; }
+  if (strcmp(op, "patch") || !doc["cfg"].is<JsonObjectConst>()) { c->text("{\"op\":\"err\",\"err\":\"bad op\"}"); return; }
+
+  uint32_t gen = 0;
+  const bool ok = patchCfg(doc["cfg"], doc["save"] | false, doc["gen"] | 0u, gen);
+  char buf[72];
+  snprintf(buf, sizeof(buf), "{\"op\":\"ack\",\"ok\":%s,\"gen\":%lu%s}",
+           ok ? "true" : "false", (unsigned long)gen, ok ? "" : ",\"err\":\"stale\"");
+  c->text(buf);
+}
+
+// loop(): commit staged web changes, then push the new config (coalesced).
+static void serviceWeb() {
+  if (resetReq.exchange(false)) { commitReq.store(false); resetToDefaults(); }
+  if (commitReq.exchange(false)) commitStaged();
+  if (!ws) return;
+  const uint32_t now = millis();
+  if (now - wsCleanMs >= 1000) { wsCleanMs = now; ws->cleanupClients(); }
+  if (!ws->count()) { wsSentGen = cfgGen; return; }     // new clients get it on connect
+  if (cfgGen == wsSentGen || now - wsSentMs < RGBCTRL_WS_NOTIFY_MS) return;
+  if (!ws->availableForWriteAll()) return;              // a slow client: try next pass
+  wsSentGen = cfgGen; wsSentMs = now;
+  ws->textAll(wsConfigMsg());
+}
 
 // -------------------- Public API --------------------
 void begin(const RGBCtrlPins& pins) {
   PINS = pins;
+  if (!snapMutex) snapMutex = xSemaphoreCreateMutex();
+  if (!stageMutex) stageMutex = xSemaphoreCreateMutex();
+  cfgGen = esp_random() | 1;
 
-  // Bind pins/length, then init (start at 0 brightness so fade begins from black)
-  strip1.updateLength(MAX_PER_CH); strip1.setPin(PINS.ch1);
-  strip2.updateLength(MAX_PER_CH); strip2.setPin(PINS.ch2);
-  strip3.updateLength(MAX_PER_CH); strip3.setPin(PINS.ch3);
-  strip4.updateLength(MAX_PER_CH); strip4.setPin(PINS.ch4);
+  // Load the LAST SAVED preferences from NVS on boot (counts size the strips)
+  loadConfig();
+  RGBstats::bootMark(RGBstats::BOOT_CONFIG);
+
+  // Bind pins/length, then init (cleared, so the boot fade begins from black)
+  strip1.updateLength(CFG.count[0]); strip1.setPin(PINS.ch1);
+  strip2.updateLength(CFG.count[1]); strip2.setPin(PINS.ch2);
+  strip3.updateLength(CFG.count[2]); strip3.setPin(PINS.ch3);
+  strip4.updateLength(CFG.count[3]); strip4.setPin(PINS.ch4);
 
   for (uint8_t s=0;s<NUM_CH;++s) {
     STRIPS[s]->begin();
     STRIPS[s]->clear();
-    STRIPS[s]->setBrightness(0);   // start dark
+    STRIPS[s]->setBrightness(255); // passthrough; brightness is applied in blitRing()
     STRIPS[s]->show();
+#if RGBCTRL_ASYNC_OUT
+    RGBout::attach(*STRIPS[s]);
+#else
+    RGBout::track(*STRIPS[s]);
+#endif
   }
   lastAppliedBrightness = 0;
 
-  memset(heat, 0, sizeof(heat));
 
-  // Load the LAST SAVED preferences from NVS on boot
-  loadConfig();
   applyConfig();  // applies counts etc. (we will override brightness below)
 
   // Arm boot fade to target brightness
   bootFadeTarget   = CFG.brightness;
   bootFadeStartMs  = millis();
   bootFadeActive   = true;
-  for (uint8_t s=0; s<NUM_CH; ++s) STRIPS[s]->setBrightness(0);
   lastAppliedBrightness = 0;
 
-  // Render once; showRing() will apply the fade ramp
+  // Render once; showRing() will apply the fade ramp (from the render task
+  // or loop(): setup() no longer waits on the network, so either runs it)
   renderFrame();
+
+#if RGBCTRL_RENDER_TASK
+  startRenderTask();
+#endif
+}
+
+bool startRenderTask() {
+  if (renderTaskHandle) return true;
+  BaseType_t ok = xTaskCreatePinnedToCore(renderTaskMain, "rgbRender", RGBCTRL_RENDER_STACK,
+                                          nullptr, RGBCTRL_RENDER_PRIO, &renderTaskHandle,
+                                          RGBCTRL_RENDER_CORE);
+  if (ok != pdPASS) { renderTaskHandle = nullptr; return false; }
+  return true;
 }
 
 void attachWeb(AsyncWebServer& server, const char* basePath) {
   gBase = basePath && *basePath ? basePath : "/config";
 
-  // Serve UI (embed last-saved config as BOOT JSON for instant fill)
+  if (!ws) {
+    ws = new AsyncWebSocket(gBase + "/ws");
+    ws->onEvent(wsOnEvent);
+    server.addHandler(ws);
+  }
+
+  // Serve UI: static gzip'd page from flash, revalidated by ETag
   server.on(gBase.c_str(), HTTP_GET, [](AsyncWebServerRequest *request){
-    // ensure we reflect latest saved state
-    loadConfig();
-    applyConfig();
-    String html = FPSTR(INDEX_HTML);
-    html.replace("%%BASE%%", gBase);
-    html.replace("%%BOOTJSON%%", configToJson());
-    html.replace("%%VERSION%%", APP_VERSION);
-    html.replace("%%COPYRIGHT%%", COPYRIGHT_TXT);
-    // Explicitly disable caching for the main HTML
-    AsyncWebServerResponse* resp = request->beginResponse(200, "text/html", html);
-    resp->addHeader("Cache-Control", "no-store");
-    request->send(resp);
+    WiFiMgr::sendGzPage(request, CONFIG_HTML_GZ, CONFIG_HTML_GZ_LEN,
+                        String(APP_VERSION) + "-" + CONFIG_HTML_ETAG);
   });
 
-  // Also add a default no-store for safety
-  DefaultHeaders::Instance().addHeader("Cache-Control", "no-store");
-
-  // GET config (also reload from NVS so page sees LAST SAVED prefs)
+  // GET config (live, in-RAM; includes any unsaved preview). ETag is the
+  // config generation; If-None-Match or ?since=<gen> gets a 304 when the
+  // config hasn't changed since.
   server.on(String(gBase + "/api/ledconfig").c_str(), HTTP_GET, [](AsyncWebServerRequest *request){
-    loadConfig();        // pull from flash
-    applyConfig();       // apply to strips (counts/brightness)
-    String body = configToJson();
+    uint32_t since = 0, gen = 0;
+    if (request->hasHeader("If-None-Match")) since = genFromTag(request->getHeader("If-None-Match")->value());
+    else if (request->hasParam("since"))     since = (uint32_t)strtoul(request->getParam("since")->value().c_str(), nullptr, 10);
+    if (since && since == cfgGen) {
+      AsyncWebServerResponse* resp = request->beginResponse(304, "application/json", "");
+      resp->addHeader("ETag", genTag(since));
+      resp->addHeader("Cache-Control", "no-store");
+      request->send(resp);
+      return;
+    }
+    String body = liveConfigJson(gen);
     AsyncWebServerResponse* resp = request->beginResponse(200, "application/json", body);
+    resp->addHeader("ETag", genTag(gen));
     resp->addHeader("Cache-Control", "no-store");
     request->send(resp);
   });
 
+  // PATCH config: only the fields that changed (?save=1 also persists).
+  // Send If-Match: "g<gen>" (or ?gen=) to have it refused with 412 if the
+  // config moved on since; the reply carries the new generation.
+  server.on(String(gBase + "/api/ledconfig").c_str(), HTTP_PATCH,
+    [](AsyncWebServerRequest *request) {},
+    nullptr,
+    [](AsyncWebServerRequest *req, uint8_t *data, size_t len, size_t index, size_t total){
+      const bool save = req->hasParam("save") && req->getParam("save")->value() == "1";
+      onCfgBody(req, data, len, index, total, save, /*patch=*/true);
+    }
+  );
+
   // POST preview (apply but don't save) + render immediately
   server.on(String(gBase + "/api/ledpreview").c_str(), HTTP_POST,
     [](AsyncWebServerRequest *request) {},
     nullptr,
     [](AsyncWebServerRequest *req, uint8_t *data, size_t len, size_t index, size_t total){
-      if (index == 0) {
-        req->_tempObject = new String();
-        ((String*)req->_tempObject)->reserve(total ? total : 256);
-      }
-      String* body = (String*)req->_tempObject;
-      body->concat((const char*)data, len);
-      if (index + len == total) {
-        AppConfig tmp = CFG;
-        if (!parseConfig(*body, tmp)) {
-          req->send(400, "text/plain", "Bad JSON");
-        } else {
-          CFG = tmp; inPreview = true; applyConfig();
-          renderFrame();
-          req->send(200, "application/json", "{\"ok\":true}");
-        }
-        delete body; req->_tempObject = nullptr;
-      }
+      onCfgBody(req, data, len, index, total, /*save=*/false);
     }
   );
 
+
   // POST save (apply + persist) + render immediately
   server.on(String(gBase + "/api/ledsave").c_str(), HTTP_POST,
     [](AsyncWebServerRequest *request) {},
     nullptr,
     [](AsyncWebServerRequest *req, uint8_t *data, size_t len, size_t index, size_t total){
-      if (index == 0) {
-        req->_tempObject = new String();
-        ((String*)req->_tempObject)->reserve(total ? total : 256);
-      }
-      String* body = (String*)req->_tempObject;
-      body->concat((const char*)data, len);
-      if (index + len == total) {
-        AppConfig tmp = CFG;
-        if (!parseConfig(*body, tmp)) {
-          req->send(400, "text/plain", "Bad JSON");
-        } else {
-          CFG = tmp; inPreview = false; applyConfig(); saveConfig();
-          renderFrame();
-          req->send(200, "application/json", "{\"ok\":true}");
-        }
-        delete body; req->_tempObject = nullptr;
-      }
+      onCfgBody(req, data, len, index, total, /*save=*/true);
     }
   );
 
+
   // POST reset (defaults) + render immediately
   server.on(String(gBase + "/api/ledreset").c_str(), HTTP_POST, [](AsyncWebServerRequest *request){
-    prefs.begin(NVS_NS, false); prefs.remove(NVS_KEY); prefs.end();
-    defaults(); inPreview = false; applyConfig();
-    renderFrame();
+    resetReq.store(true);                 // done by serviceWeb() on loop()
     request->send(200, "application/json", "{\"ok\":true}");
   });
+
+  // GET since-boot counters and latency histograms (see getStatsJson)
+  server.on(String(gBase + "/api/stats").c_str(), HTTP_GET, [](AsyncWebServerRequest *request){
+    AsyncWebServerResponse* resp = request->beginResponse(200, "application/json", getStatsJson());
+    resp->addHeader("Cache-Control", "no-store");
+    request->send(resp);
+  });
+
+  // POST starts the render benchmark (?frames=N, default 64); GET polls it
+  server.on(String(gBase + "/api/bench").c_str(), HTTP_POST, [](AsyncWebServerRequest *request){
+    uint16_t frames = 64;
+    if (request->hasParam("frames")) frames = (uint16_t)request->getParam("frames")->value().toInt();
+    if (!benchStart(frames)) { request->send(409, "application/json", "{\"ok\":false,\"err\":\"busy\"}"); return; }
+    request->send(200, "application/json", "{\"ok\":true,\"state\":\"running\"}");
+  });
+  server.on(String(gBase + "/api/bench").c_str(), HTTP_GET, [](AsyncWebServerRequest *request){
+    AsyncWebServerResponse* resp = request->beginResponse(200, "application/json", benchStatusJson());
+    resp->addHeader("Cache-Control", "no-store");
+    request->send(resp);
+  });
+
+  // GET render cost (µs per frame; fx = effect layers, blend = compositor)
+  server.on(String(gBase + "/api/perf").c_str(), HTTP_GET, [](AsyncWebServerRequest *request){
+    StaticJsonDocument<512> doc;
+    auto put = [&doc](const char* k, const PerfStat& p) {
+      JsonObject o = doc.createNestedObject(k);
+      o["last"] = p.last; o["avg"] = p.avg; o["peak"] = p.peak;
+    };
+    put("frame", perfFrame);
+    put("fx",    perfFx);
+    put("blend", perfBlend);
+    doc["layers"]  = perfLayers;
+    doc["fps"]     = RS.fps;
+    doc["pixels"]  = ringCount;
+    doc["shown"]   = RGBout::shownCount();
+    doc["skipped"] = RGBout::skippedCount();
+    JsonObject st = doc.createNestedObject("stream");
+    st["on"] = (bool)streamOn; st["frames"] = streamFrames;
+    st["packets"] = streamPackets; st["gaps"] = RGBCtrlUDP::ddpGaps();
+    JsonObject nv = doc.createNestedObject("nvs");
+    nv["writes"] = nvsWrites; nv["requests"] = nvsRequests;
+    nv["unchanged"] = nvsUnchanged; nv["pending"] = (bool)saveDirty;
+    String body; serializeJson(doc, body);
+    AsyncWebServerResponse* resp = request->beginResponse(200, "application/json", body);
+    resp->addHeader("Cache-Control", "no-store");
+    request->send(resp);
+  });
 }
 
 // Convenience overload: uses WiFiMgr::getServer()
@@ -1665,11 +2855,11 @@ void attachWeb(const char* basePath) {
 }
 
 void loop() {
-  uint8_t frameMs = 10 + (uint8_t)((255 - CFG.speed)/2); // faster speed -> shorter frame
-  uint32_t now = millis();
-  if (now - msPrev >= frameMs) {
-    msPrev = now;
-    ++tick;
+  serviceSave();                  // deferred NVS write, never from the render path
+  serviceWeb();                   // staged web changes, WebSocket pushes
+  if (renderTaskHandle) return;   // frames are paced by the render task
+
+  if (frameDue(micros())) {
     renderFrame();
 
     RGBCtrlUDP::processPending(1500);
@@ -1681,52 +2871,298 @@ void setCounts(uint16_t c1, uint16_t c2, uint16_t c3, uint16_t c4) {
   CFG.count[1] = (c2 > MAX_PER_CH) ? MAX_PER_CH : c2;
   CFG.count[2] = (c3 > MAX_PER_CH) ? MAX_PER_CH : c3;
   CFG.count[3] = (c4 > MAX_PER_CH) ? MAX_PER_CH : c4;
-  rebuildRingMap();
+  fitCounts(CFG.count);
+  publishConfig();
+  bumpGen();
 }
 
-void forceSave() { saveConfig(); }
-void forceLoad() { loadConfig(); applyConfig(); }
+void forceSave() { saveDirty = false; saveConfig(); }
+void flushSave() { flushPendingSave(); }
+void forceLoad() { loadConfig(); applyConfig(); bumpGen(); }
 
 // SMBus flags accessors (for RGBsmbus to check)
+// -------------------- Realtime stream API --------------------
+// Resize both stream buffers to n pixels (caller context of streamWrite).
+// On failure the old ones stay and the tail of the ring is dropped.
+static void streamFit(uint16_t n) {
+  Rgb16* m = (Rgb16*)calloc((size_t)(n ? n : 1) * 2, sizeof(Rgb16));
+  if (!m) return;
+  if (streamCap) memcpy(m, streamBack, (n < streamCap ? n : streamCap) * sizeof(Rgb16));
+  portENTER_CRITICAL(&streamMux);
+  Rgb16* const old = streamBack;
+  streamBack = m; streamFront = m + (n ? n : 1); streamCap = n;
+  portEXIT_CRITICAL(&streamMux);
+  free(old);
+}
+
+bool streamWrite(uint8_t target, uint32_t offset, const uint8_t* data, size_t len, bool push) {
+  if (target > NUM_CH) return false;
+  ++streamPackets;
+
+  // Target 0 is the whole ring in ring order; 1..4 are CH1..CH4 in physical
+  // pixel order (reverse is undone here so pixel 0 is the strip's first LED).
+  uint16_t start = 0, n = 0;
+  bool rev = false;
+  for (uint8_t c=0; c<NUM_CH; ++c) n += CFG.count[c];
+  if (n != streamCap) streamFit(n);
+  if (target) {
+    const uint8_t ch = target - 1;
+    for (uint8_t c=0; c<ch; ++c) start += CFG.count[c];
+    n   = CFG.count[ch];
+    rev = CFG.reverse[ch];
+  }
+
+  // Byte-granular copy: DDP offsets need not be pixel aligned.
+  uint32_t pos = offset;
+  for (size_t j=0; j<len; ++j, ++pos) {
+    const uint32_t px = pos / 3;
+    if (px >= n) break;
+    const uint16_t ring = start + (uint16_t)(rev ? (n - 1 - px) : px);
+    if (ring >= streamCap) break;
+    const uint16_t v = (uint16_t)(data[j] * 257u);
+    switch (pos % 3) {
+      case 0: streamBack[ring].R = v; break;
+      case 1: streamBack[ring].G = v; break;
+      default: streamBack[ring].B = v; break;
+    }
+  }
+
+  if (push) {
+    portENTER_CRITICAL(&streamMux);
+    memcpy(streamFront, streamBack, streamCap * sizeof(Rgb16));
+    portEXIT_CRITICAL(&streamMux);
+    streamLastMs = millis();
+    streamOn = true;
+    ++streamFrames;
+    kickRender();                 // show it now rather than at the next slot
+  }
+  return true;
+}
+
+bool streamActive() { return streamOn; }
+
+// -------------------- Multi-unit sync API --------------------
+void syncEnable(bool on) {
+  if (on == syncOn) return;
+  if (on) {
+    // Show clock starts as local time; followers move it on the first beacon.
+    portENTER_CRITICAL(&syncMux);
+    syncOffsetUs = 0;
+    portEXIT_CRITICAL(&syncMux);
+  }
+  syncOn = on;
+}
+
+bool syncEnabled() { return syncOn; }
+
+int64_t syncClockUs() { return showClockUs(); }
+
+void syncAdjustClock(int64_t offsetUs) {
+  portENTER_CRITICAL(&syncMux);
+  syncOffsetUs = offsetUs;
+  portEXIT_CRITICAL(&syncMux);
+}
+
+int64_t syncClockOffsetUs() {
+  portENTER_CRITICAL(&syncMux);
+  const int64_t off = syncOffsetUs;
+  portEXIT_CRITICAL(&syncMux);
+  return off;
+}
+
+bool syncPlaylistState(uint32_t& crc, uint8_t& idx, uint32_t& stepMs) {
+  if (RS.mode != MODE_CUSTOM || !plActive) return false;
+  crc = plCrc; idx = plIdx;
+  stepMs = millis() - plStepStart;
+  return true;
+}
+
+void syncPlaylistTo(uint32_t crc, uint8_t idx, uint32_t stepMs) {
+  portENTER_CRITICAL(&syncMux);
+  syncStep.crc = crc; syncStep.idx = idx;
+  syncStep.stepMs = stepMs; syncStep.rxMs = millis();
+  syncStepPending = true;
+  portEXIT_CRITICAL(&syncMux);
+}
+
 bool smbusCpuEnabled() { return CFG.enableCpu; }
 bool smbusFanEnabled() { return CFG.enableFan; }
 
 // -------------------- JSON helpers for UDP/external control --------------------
+bool applyJsonPreview(JsonVariantConst cfg) { return applyCfg(cfg, false); }
+bool applyJsonSave(JsonVariantConst cfg)    { return applyCfg(cfg, true); }
+
 bool applyJsonPreview(const String& json) {
-  AppConfig tmp = CFG;
-  if (!parseConfig(json, tmp)) return false;
-  CFG = tmp;
-  inPreview = true;
-  applyConfig();
-  renderFrame();
-  return true;
+  StaticJsonDocument<2048> doc;
+  if (deserializeJson(doc, json)) return false;
+  return applyCfg(doc.as<JsonVariantConst>(), false);
 }
 
 bool applyJsonSave(const String& json) {
-  AppConfig tmp = CFG;
-  if (!parseConfig(json, tmp)) return false;
-  CFG = tmp;
-  inPreview = false;
-  applyConfig();
-  saveConfig();
-  renderFrame();
+  StaticJsonDocument<2048> doc;
+  if (deserializeJson(doc, json)) return false;
+  return applyCfg(doc.as<JsonVariantConst>(), true);
+}
+
+bool stageJson(JsonVariantConst cfg, bool save) {
+  if (!cfg.is<JsonObjectConst>()) return false;
+  stageLock();
+  stageMerge(cfg, save);
+  stageUnlock();
   return true;
 }
 
+bool commitStaged() {
+  stageLock();
+  const bool did = stageCommit();
+  stageUnlock();
+  if (did) kickRender();
+  return did;
+}
+
 String getConfigJson() {
-  return configToJson();
+  uint32_t gen;
+  return liveConfigJson(gen);
+}
+String getConfigJson(uint32_t& gen) { return liveConfigJson(gen); }
+
+uint32_t configGen() { return cfgGen; }
+
+bool stagePatch(JsonVariantConst cfg, uint32_t baseGen, bool save, uint32_t& gen) {
+  if (!cfg.is<JsonObjectConst>()) { gen = cfgGen; return false; }
+  stageLock();
+  const bool ok = stageMergeIf(cfg, save, baseGen, gen);
+  stageUnlock();
+  return ok;
+}
+
+// Keys for the per-mode render stats (index = mode).
+static const char* const STAT_MODE_KEYS[MODE_COUNT] = {
+  "solid", "breathe", "wipe", "larson", "rainbow", "theater", "twinkle",
+  "comet", "meteor", "clock", "plasma", "fire", "palCycle", "palChase", "custom",
+  "tempReact", "fanReact"
+};
+
+// Everything /api/stats reports. With every mode populated the document
+// needs ~3.5 KB, more than we want on the AsyncTCP or loop() stack, so it is
+// heap-backed for the duration of the call. A section gives just that part
+// (each fits one UDP datagram); "summary" is a few headline numbers.
+String getStatsJson(const char* section) {
+  const bool all = !section || !*section;
+  auto want = [&](const char* s) { return all || !strcmp(section, s); };
+  if (!all && !want("summary") && !want("render") && !want("modes") &&
+      !want("udp") && !want("smbus") && !want("sys")) return String();
+
+  DynamicJsonDocument doc(all ? 6144 : 2048);
+  doc["uptimeMs"] = millis();
+
+  if (want("summary")) {
+    JsonObject r = doc.createNestedObject("render");
+    r["fps"]     = statFpsX10 / 10.0f;
+    r["target"]  = RS.fps;
+    r["shown"]   = RGBout::shownCount();
+    r["skipped"] = RGBout::skippedCount();
+    JsonObject h = doc.createNestedObject("heap");
+    h["free"]    = ESP.getFreeHeap();
+    h["minFree"] = ESP.getMinFreeHeap();
+    String out; serializeJson(doc, out);
+    return out;
+  }
+
+  if (want("render") || want("modes")) {
+    JsonObject r = doc.createNestedObject("render");
+    if (want("render")) {
+      r["fps"]     = statFpsX10 / 10.0f;
+      r["target"]  = RS.fps;
+      r["shown"]   = RGBout::shownCount();
+      r["skipped"] = RGBout::skippedCount();
+      RGBstats::put(r.createNestedObject("frame"),  statFrame);
+      RGBstats::put(r.createNestedObject("jitter"), statJitter);
+      JsonArray show = r.createNestedArray("show");         // CH1..CH4
+      for (uint8_t c=0; c<NUM_CH; ++c) RGBstats::put(show.createNestedObject(), statShow[c]);
+    }
+    if (want("modes")) {
+      JsonObject modes = r.createNestedObject("modes");
+      for (uint8_t m=0; m<MODE_COUNT; ++m)
+        if (statMode[m].n) RGBstats::put(modes.createNestedObject(STAT_MODE_KEYS[m]), statMode[m]);
+    }
+  }
+
+  if (want("udp"))   RGBCtrlUDP::statsJson(doc.createNestedObject("udp"));
+  if (want("smbus")) RGBsmbus::statsJson(doc.createNestedObject("smbus"));
+
+  if (want("sys")) {
+    JsonObject nv = doc.createNestedObject("nvs");
+    nv["writes"]    = nvsWrites;
+    nv["requests"]  = nvsRequests;
+    nv["unchanged"] = nvsUnchanged;
+    nv["pending"]   = (bool)saveDirty;
+    RGBstats::put(nv.createNestedObject("write"), statNvs);
+
+    JsonObject h = doc.createNestedObject("heap");
+    h["free"]    = ESP.getFreeHeap();
+    h["minFree"] = ESP.getMinFreeHeap();
+    h["largest"] = ESP.getMaxAllocHeap();
+
+    RGBstats::putBoot(doc.createNestedObject("boot"));   // ms since power-on
+
+    JsonArray zs = doc.createNestedArray("zones");        // render-side zone counters
+    for (uint8_t z=0; z<nZones; ++z) {
+      JsonObject o = zs.createNestedObject();
+      o["px"] = zr[z].len; o["renders"] = zr[z].renders; o["skips"] = zr[z].skips;
+    }
+    if (zoneShort) doc["zonesShort"] = true;
+
+    JsonObject pl = doc.createNestedObject("pool");       // ring-sized buffers
+    pl["px"]      = poolCap;
+    pl["bytes"]   = (uint32_t)poolCap * POOL_PX_BYTES + (uint32_t)streamCap * 2 * sizeof(Rgb16);
+    pl["short"]   = poolShort;
+    pl["fits"]    = poolFits;
+    pl["limit"]   = ringLimit();
+  }
+
+  String out; serializeJson(doc, out);
+  return out;
+}
+
+bool benchStart(uint16_t frames) {
+  if (benchState == BENCH_REQ || benchState == BENCH_RUN) return false;
+  benchFrames = frames < 1 ? 1 : (frames > 1024 ? 1024 : frames);
+  benchState  = BENCH_REQ;                  // picked up by the next frame
+  return true;
+}
+
+String benchStatusJson() {
+  const uint8_t st = benchState;
+  if (st == BENCH_REQ || st == BENCH_RUN) return "{\"state\":\"running\"}";
+  if (st == BENCH_IDLE) return "{\"state\":\"idle\"}";
+  stageLock();
+  String out = "{\"state\":\"done\",\"bench\":" + benchOut + "}";
+  stageUnlock();
+  return out;
+}
+
+// -------------------- OTA progress API --------------------
+void otaBegin()                    { otaPermille = OTA_PM_UNKNOWN; otaState = OTA_RUN; }
+void otaProgress(uint16_t permille) { otaPermille = permille > 1000 ? 1000 : permille; }
+void otaEnd(bool ok) {
+  otaEndMs = millis();
+  otaState = ok ? OTA_OK : OTA_FAIL;
 }
 
 void resetToDefaults() {
-  // Match the web-reset behavior: erase saved prefs and apply defaults (no save)
-  prefs.begin(NVS_NS, false);
-  prefs.remove(NVS_KEY);
-  prefs.end();
+  // Erase saved prefs and apply defaults (no save). Anything still staged
+  // predates the reset, so it is dropped rather than committed on top.
+  eraseSaved();
 
+  stageLock();
+  stageValid = false;
   defaults();
   inPreview = false;
   applyConfig();
-  renderFrame();
+  bumpGenLocked();
+  stageUnlock();
+  kickRender();
 }
 
 } // namespace RGBCtrl
@@ -1,6 +1,7 @@
 #pragma once
 #include <Arduino.h>
 #include <ESPAsyncWebServer.h>
+#include <ArduinoJson.h>
 
 // ---- Public API -------------------------------------------------------------
 struct RGBCtrlPins {
@@ -18,12 +19,17 @@ void attachWeb(AsyncWebServer& server, const char* basePath = "/config");
 // Convenience overload that grabs the server from WiFiMgr::getServer().
 void attachWeb(const char* basePath = "/config");
 
-// Call every loop() to render animations.
+// Call every loop() to render animations (no-op once the render task runs).
 void loop();
 
+// Optional: move rendering onto its own FreeRTOS task pinned to the core that
+// does not run loop(). begin() calls this when RGBCTRL_RENDER_TASK is 1.
+bool startRenderTask();
+
 // Optional helpers (used rarely, but exposed for convenience)
-void setCounts(uint16_t c1, uint16_t c2, uint16_t c3, uint16_t c4); // 0..50 each
-void forceSave();   // persist current config to NVS
+void setCounts(uint16_t c1, uint16_t c2, uint16_t c3, uint16_t c4); // 0..RGBCTRL_MAX_PER_CH each, trimmed to fit the heap
+void forceSave();   // persist current config to NVS now
+void flushSave();   // write a pending (debounced) save now, e.g. before reboot
 void forceLoad();   // reload config from NVS, re-applies
 
 // SMBus gating flags (so your RGBsmbus module can check them)
@@ -32,15 +38,74 @@ bool smbusFanEnabled();
 
 // ----- JSON control helpers (for UDP or any external controller) -----
 // Apply a JSON config (same schema as the Web UI) without saving to NVS.
+// Fields that are absent keep their current value.
+bool applyJsonPreview(JsonVariantConst cfg);
 bool applyJsonPreview(const String& json);
 
 // Apply a JSON config and save it to NVS.
+bool applyJsonSave(JsonVariantConst cfg);
 bool applyJsonSave(const String& json);
 
-// Get the current config as JSON (same schema Web UI returns).
+// Two-phase apply for callers that parse in a hot path and apply later:
+// stageJson() merges a parsed config into a pending copy (successive calls
+// accumulate; a save anywhere in the batch makes the commit persist), and
+// commitStaged() applies it. Returns false if nothing was pending.
+bool stageJson(JsonVariantConst cfg, bool save);
+bool commitStaged();
+
+// Field-level deltas with config versioning. Every accepted change bumps the
+// config generation. stagePatch() is stageJson() that only merges when
+// baseGen is 0 or still current; gen receives the generation afterwards
+// (the new one, or the current one if it was refused as stale).
+uint32_t configGen();
+bool stagePatch(JsonVariantConst cfg, uint32_t baseGen, bool save, uint32_t& gen);
+
+// Get the current config as JSON (same schema Web UI returns), including
+// staged changes; the overload also returns the generation it matches.
 String getConfigJson();
+String getConfigJson(uint32_t& gen);
+// Runtime counters/histograms as JSON (render, UDP, SMBus, NVS, heap);
+// served by GET <base>/api/stats. A section ("summary", "render", "modes",
+// "udp", "smbus", "sys") returns only that part, small enough for one UDP
+// reply; an unknown one returns an empty string.
+String getStatsJson(const char* section = nullptr);
+
+// Render benchmark: every effect at several ring lengths with fixed inputs,
+// run on the renderer one case per frame (the ring holds its last frame
+// meanwhile; loop() keeps being serviced between cases).
+// benchStart() returns false while one is pending; benchStatusJson() gives
+// {"state":"idle"|"running"} or {"state":"done","bench":{...}}.
+bool   benchStart(uint16_t frames = 64);
+String benchStatusJson();
+
+// OTA progress display (driven by WiFiMgr). While active the ring shows a
+// progress bar at RGBCTRL_OTA_FPS instead of the animation; otaEnd(true)
+// holds it green until reboot, otaEnd(false) blinks red and then resumes.
+void otaBegin();                        // size unknown: spinner
+void otaProgress(uint16_t permille);    // 0..1000
+void otaEnd(bool ok);
 
 // Restore factory defaults, apply, and render immediately.
 void resetToDefaults();
 
+// ----- Realtime pixel stream (DDP, see RGBudp) -----
+// Write raw RGB bytes into the stream buffer. target 0 = whole ring (ring
+// order CH1..CH4), 1..4 = one channel in physical pixel order. offset is in
+// bytes. push=true shows the buffered frame; the normal animation resumes
+// RGBCTRL_STREAM_TIMEOUT_MS after the last push.
+bool streamWrite(uint8_t target, uint32_t offset, const uint8_t* data, size_t len, bool push);
+bool streamActive();
+
+// Multi-unit sync hooks (used by RGBCtrlUDP). With sync on, animation clocks
+// follow a shared show clock (local µs + offset) instead of free-running.
+void    syncEnable(bool on);
+bool    syncEnabled();
+int64_t syncClockUs();                       // current show clock (µs)
+int64_t syncClockOffsetUs();
+void    syncAdjustClock(int64_t offsetUs);   // show clock = esp_timer + offset
+// Leader side: current playlist step (false when no playlist runs).
+bool    syncPlaylistState(uint32_t& crc, uint8_t& idx, uint32_t& stepMs);
+// Follower side: jump to a step if our playlist table has the same crc.
+void    syncPlaylistTo(uint32_t crc, uint8_t idx, uint32_t stepMs);
+
 } // namespace RGBCtrl
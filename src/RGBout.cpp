@@ -0,0 +1,226 @@
+#include "RGBout.h"
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include <stdlib.h>
+
+#if defined(ARDUINO_ARCH_ESP32)
+  #include "soc/soc_caps.h"
+#endif
+
+// ========================= USER CONFIG =========================
+// Async RMT output needs the Arduino-ESP32 3.x RMT HAL (rmtWriteAsync).
+#ifndef RGBOUT_USE_RMT
+  #if defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 3) && defined(SOC_RMT_SUPPORTED)
+    #define RGBOUT_USE_RMT 1
+  #else
+    #define RGBOUT_USE_RMT 0
+  #endif
+#endif
+
+// How many strips may hold an RMT TX channel permanently. Two channels are
+// left free: one for the status LED (neopixelWrite) and one for strips on the
+// blocking Adafruit path, which claims a channel per show(). On an S3 (4 TX
+// channels) that means two parallel channels; classic ESP32 (8) gets six.
+#ifndef RGBOUT_MAX_ASYNC
+  #if defined(SOC_RMT_TX_CANDIDATES_PER_GROUP) && (SOC_RMT_TX_CANDIDATES_PER_GROUP > 2)
+    #define RGBOUT_MAX_ASYNC (SOC_RMT_TX_CANDIDATES_PER_GROUP - 2)
+  #else
+    #define RGBOUT_MAX_ASYNC 0
+  #endif
+#endif
+
+// WS2812 needs >= 280 µs of low line between frames to latch.
+#ifndef RGBOUT_LATCH_US
+#define RGBOUT_LATCH_US 300
+#endif
+
+// showIfChanged(): re-send an unchanged frame at least this often anyway, so a
+// strip that glitched (noise, hot-plug) recovers on its own. 0 = never.
+#ifndef RGBOUT_REFRESH_MS
+#define RGBOUT_REFRESH_MS 1000
+#endif
+
+// Strips tracked for dirty-frame detection (CH1..CH6 plus headroom).
+#ifndef RGBOUT_MAX_TRACKED
+#define RGBOUT_MAX_TRACKED 8
+#endif
+// ===============================================================
+
+namespace RGBout {
+
+// -------------------- Dirty-frame tracking --------------------
+// One entry per attached strip (async or not). Entries are only added from
+// attach(), i.e. during setup, so the lookup needs no locking.
+struct Track {
+  const Adafruit_NeoPixel* strip = nullptr;
+  uint32_t hash   = 0;
+  uint32_t sentMs = 0;
+  bool     valid  = false;
+};
+static Track    tracks[RGBOUT_MAX_TRACKED];
+static uint8_t  nTracks = 0;
+static uint32_t nShown = 0, nSkipped = 0;
+
+static Track* findTrack(const Adafruit_NeoPixel& strip) {
+  for (uint8_t i=0; i<nTracks; ++i) if (tracks[i].strip == &strip) return &tracks[i];
+  return nullptr;
+}
+void track(const Adafruit_NeoPixel& strip) {
+  if (findTrack(strip) || nTracks >= RGBOUT_MAX_TRACKED) return;
+  tracks[nTracks++].strip = &strip;
+}
+
+// FNV-1a over the wire bytes plus length and brightness.
+static uint32_t frameHash(const Adafruit_NeoPixel& strip) {
+  uint32_t h = 2166136261u;
+  const uint8_t* px = strip.getPixels();
+  const size_t   n  = (size_t)strip.numPixels() * 3;
+  for (size_t i=0; i<n; ++i) { h ^= px[i]; h *= 16777619u; }
+  h ^= strip.numPixels();   h *= 16777619u;
+  h ^= strip.getBrightness(); h *= 16777619u;
+  return h;
+}
+
+bool showIfChanged(Adafruit_NeoPixel& strip) {
+  Track* t = findTrack(strip);
+  if (!t) { show(strip); ++nShown; return true; }
+
+  const uint32_t h   = frameHash(strip);
+  const uint32_t now = millis();
+  const bool stale = RGBOUT_REFRESH_MS && (now - t->sentMs >= RGBOUT_REFRESH_MS);
+  if (t->valid && t->hash == h && !stale) { ++nSkipped; return false; }
+
+  show(strip);
+  t->hash = h; t->sentMs = now; t->valid = true;
+  ++nShown;
+  return true;
+}
+
+void invalidate(const Adafruit_NeoPixel& strip) {
+  if (Track* t = findTrack(strip)) t->valid = false;
+}
+
+uint32_t shownCount()   { return nShown; }
+uint32_t skippedCount() { return nSkipped; }
+
+#if RGBOUT_USE_RMT && (RGBOUT_MAX_ASYNC > 0)
+
+// 10 MHz RMT tick (100 ns). Same bit timings Adafruit uses on IDF5.
+static const uint32_t RMT_HZ   = 10000000;
+static const uint16_t T0H = 4, T0L = 8;   // 400 ns / 800 ns
+static const uint16_t T1H = 8, T1L = 4;   // 800 ns / 400 ns
+static const uint32_t BIT_NS   = 1200;
+
+struct Slot {
+  Adafruit_NeoPixel* strip = nullptr;
+  int        pin      = -1;
+  rmt_data_t* sym     = nullptr;   // encoded symbols, 8 per byte
+  size_t     cap      = 0;         // capacity in symbols
+  bool       busy     = false;
+  uint32_t   startUs  = 0;
+  uint32_t   durUs    = 0;
+};
+static Slot    slots[RGBOUT_MAX_ASYNC];
+static uint8_t nSlots = 0;
+
+static rmt_data_t SYM0, SYM1;
+static bool symInit = false;
+
+static void initSymbols() {
+  if (symInit) return;
+  SYM0.level0 = 1; SYM0.duration0 = T0H; SYM0.level1 = 0; SYM0.duration1 = T0L;
+  SYM1.level0 = 1; SYM1.duration0 = T1H; SYM1.level1 = 0; SYM1.duration1 = T1L;
+  symInit = true;
+}
+
+static Slot* find(const Adafruit_NeoPixel& strip) {
+  for (uint8_t i=0; i<nSlots; ++i) if (slots[i].strip == &strip) return &slots[i];
+  return nullptr;
+}
+
+static bool ensureCapacity(Slot& s, size_t symbols) {
+  if (symbols <= s.cap) return true;
+  rmt_data_t* n = (rmt_data_t*)realloc(s.sym, symbols * sizeof(rmt_data_t));
+  if (!n) return false;
+  s.sym = n; s.cap = symbols;
+  return true;
+}
+
+// Wait for the slot's previous frame to finish and the latch gap to pass.
+static bool waitSlot(Slot& s, uint32_t timeout_us) {
+  if (!s.busy) return true;
+  const uint32_t t0 = micros();
+  while (!rmtTransmitCompleted(s.pin)) {
+    if (micros() - t0 >= timeout_us) return false;
+    yield();
+  }
+  const uint32_t doneAt = s.startUs + s.durUs + RGBOUT_LATCH_US;
+  const int32_t  left   = (int32_t)(doneAt - micros());
+  if (left > 0) delayMicroseconds((uint32_t)left);
+  s.busy = false;
+  return true;
+}
+
+bool attach(Adafruit_NeoPixel& strip) {
+  track(strip);
+  if (find(strip)) return true;
+  if (nSlots >= RGBOUT_MAX_ASYNC) return false;
+  const int pin = strip.getPin();
+  if (pin < 0) return false;
+  if (!rmtInit(pin, RMT_TX_MODE, RMT_MEM_NUM_BLOCKS_1, RMT_HZ)) return false;
+
+  initSymbols();
+  Slot& s = slots[nSlots];
+  s = Slot();
+  s.strip = &strip;
+  s.pin   = pin;
+  if (!ensureCapacity(s, (size_t)strip.numPixels() * 24)) {
+    rmtDeinit(pin);
+    return false;
+  }
+  ++nSlots;
+  return true;
+}
+
+void show(Adafruit_NeoPixel& strip) {
+  Slot* s = find(strip);
+  if (!s) { strip.show(); return; }
+
+  const size_t bytes   = (size_t)strip.numPixels() * 3;
+  const size_t symbols = bytes * 8;
+  if (!symbols) return;
+
+  // Never touch the symbol buffer while the peripheral is still reading it.
+  if (!waitSlot(*s, 4000)) return;                 // drop this frame for the channel
+  if (!ensureCapacity(*s, symbols)) { strip.show(); return; }
+
+  const uint8_t* px = strip.getPixels();
+  rmt_data_t* out = s->sym;
+  for (size_t i=0; i<bytes; ++i) {
+    const uint8_t b = px[i];
+    for (uint8_t m=0x80; m; m >>= 1) *out++ = (b & m) ? SYM1 : SYM0;
+  }
+
+  s->startUs = micros();
+  s->durUs   = (uint32_t)((symbols * BIT_NS) / 1000);
+  s->busy    = rmtWriteAsync(s->pin, s->sym, symbols);
+}
+
+void waitIdle(uint32_t timeout_us) {
+  for (uint8_t i=0; i<nSlots; ++i) waitSlot(slots[i], timeout_us);
+}
+
+bool isAsync(const Adafruit_NeoPixel& strip) { return find(strip) != nullptr; }
+uint8_t asyncCount() { return nSlots; }
+
+#else  // blocking fallback (older cores / no RMT)
+
+bool attach(Adafruit_NeoPixel& strip) { track(strip); return false; }
+void show(Adafruit_NeoPixel& strip) { strip.show(); }
+void waitIdle(uint32_t) {}
+bool isAsync(const Adafruit_NeoPixel&) { return false; }
+uint8_t asyncCount() { return 0; }
+
+#endif
+
+} // namespace RGBout
@@ -0,0 +1,44 @@
+#pragma once
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+
+// Asynchronous WS2812 output backend shared by RGBCtrl (CH1..CH4) and
+// RGBsmbus (CH5/CH6). Attached strips are encoded into per-channel RMT
+// symbol buffers and transmitted in the background, so several channels
+// shift out at the same time and show() returns immediately. Strips that
+// are not attached (or when no RMT channel is free) fall back to the
+// blocking Adafruit_NeoPixel::show().
+namespace RGBout {
+
+// Opt a strip into async output (and dirty-frame tracking). Call after
+// begin()/setPin()/updateLength(). Returns false if the strip stays on the
+// blocking path.
+bool attach(Adafruit_NeoPixel& strip);
+
+// Start transmitting the strip's current pixel buffer. Async strips return
+// as soon as the transfer is queued; others block in Adafruit show().
+void show(Adafruit_NeoPixel& strip);
+
+// Track a strip for showIfChanged() without claiming an RMT channel
+// (attach() already does this).
+void track(const Adafruit_NeoPixel& strip);
+
+// Like show(), but skips the transmission when the strip's pixel data and
+// brightness are identical to the last frame sent (an unchanged frame is
+// still re-sent every RGBOUT_REFRESH_MS). Untracked strips are always shown. Returns true if the frame went out.
+bool showIfChanged(Adafruit_NeoPixel& strip);
+
+// Force the next showIfChanged() for this strip to transmit.
+void invalidate(const Adafruit_NeoPixel& strip);
+
+// Frames sent / skipped by showIfChanged() since boot.
+uint32_t shownCount();
+uint32_t skippedCount();
+
+// Wait (bounded) until all in-flight async transmissions have completed.
+void waitIdle(uint32_t timeout_us = 4000);
+
+bool isAsync(const Adafruit_NeoPixel& strip);
+uint8_t asyncCount();
+
+} // namespace RGBout
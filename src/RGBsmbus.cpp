@@ -1,9 +1,12 @@
 #include "RGBsmbus.h"
+#include "RGBout.h"
+#include "RGBstats.h"
 #include <Arduino.h>
 #include <Wire.h>
 #include <Adafruit_NeoPixel.h>
 #include <ESPAsyncWebServer.h>
 #include <WiFiUdp.h>
+#include <atomic>
 
 // === UDP quiet-window hook (no heavy JSON parsing while we touch SMBus) ===
 namespace RGBCtrlUDP { void enterSmbusQuietUs(uint32_t dur_us); }
@@ -57,13 +60,59 @@ extern "C" __attribute__((weak)) uint32_t smbus_last_activity_ms() {
 
 static const uint8_t  BRIGHTNESS        = 160;    // CH5/CH6 bar brightness
 
-// Cadence: very light on the bus. One RR step ~4s (+ jitter).
+// Let CH5/CH6 use the async RMT backend if RGBCtrl left channels free.
+#ifndef RGBSMBUS_ASYNC_OUT
+#define RGBSMBUS_ASYNC_OUT 1
+#endif
+
+// Shown bar fill/colour eases toward each new reading with this time constant.
+#ifndef RGBSMBUS_BAR_EASE_MS
+#define RGBSMBUS_BAR_EASE_MS 350
+#endif
+
+// Cadence: adaptive per sensor. A reading that moved (or sits near a colour
+// threshold) is re-read after RGBSMBUS_POLL_MIN_MS; each stable reading
+// doubles the interval up to RGBSMBUS_POLL_MAX_MS. Bus-busy and read
+// failures back off the same way. RGBSMBUS_POLL_MS is the first interval
+// and the re-check period while guarded/disabled.
 #ifndef RGBSMBUS_POLL_MS
 #define RGBSMBUS_POLL_MS     4000
 #endif
+#ifndef RGBSMBUS_POLL_MIN_MS
+#define RGBSMBUS_POLL_MIN_MS 1000
+#endif
+#ifndef RGBSMBUS_POLL_MAX_MS
+#define RGBSMBUS_POLL_MAX_MS 16000
+#endif
+#ifndef RGBSMBUS_POLL_NEAR_MS
+#define RGBSMBUS_POLL_NEAR_MS 2000     // ceiling while a reading is near a threshold
+#endif
 #ifndef RGBSMBUS_JITTER_MAX_MS
 #define RGBSMBUS_JITTER_MAX_MS  250
 #endif
+// A move of at least this much counts as "changing" (raw vs last / smoothed).
+#ifndef RGBSMBUS_CPU_STEP_C
+#define RGBSMBUS_CPU_STEP_C  1.0f
+#endif
+#ifndef RGBSMBUS_FAN_STEP_PCT
+#define RGBSMBUS_FAN_STEP_PCT 4.0f
+#endif
+// "Near a threshold": within this much of a colour band edge.
+#ifndef RGBSMBUS_CPU_NEAR_C
+#define RGBSMBUS_CPU_NEAR_C  2.0f
+#endif
+#ifndef RGBSMBUS_FAN_NEAR_PCT
+#define RGBSMBUS_FAN_NEAR_PCT 5.0f
+#endif
+// Bus-occupancy budget: time spent waiting for idle lines and reading, in µs
+// per second of wall time (2500 = 0.25%, about what the fixed 4 s cadence
+// used), with up to RGBSMBUS_BUS_BURST_US banked for bursts of fast reads.
+#ifndef RGBSMBUS_BUS_BUDGET_US_PER_S
+#define RGBSMBUS_BUS_BUDGET_US_PER_S 2500
+#endif
+#ifndef RGBSMBUS_BUS_BURST_US
+#define RGBSMBUS_BUS_BURST_US 30000
+#endif
 
 static const float    SMOOTH_ALPHA      = 0.35f;  // EMA smoothing
 
@@ -93,6 +142,9 @@ static const uint32_t FAIL_COLOR     = 0x400000; // dim red on error
 static const uint8_t SMC_ADDRESS   = 0x10; // SMC PIC (7-bit)
 static const uint8_t REG_CPUTEMP   = 0x09; // °C
 static const uint8_t REG_FANSPEED  = 0x10; // 0..50 -> ×2 => %  (some FW returns 0..100)
+static const uint8_t REG_BOARDTEMP = 0x0A; // °C (motherboard sensor)
+static const uint8_t REG_TRAY      = 0x03; // tray state byte
+static const uint8_t REG_AVPACK    = 0x04; // A/V pack type byte
 
 // Video encoders (7-bit) — probe to identify board family
 static const uint8_t I2C_XCALIBUR  = 0x70;
@@ -134,6 +186,63 @@ static const uint8_t I2C_XCALIBUR  = 0x70;
 #ifndef RGBSMBUS_STICKY_CLEAR_MS
 #define RGBSMBUS_STICKY_CLEAR_MS 60000UL
 #endif
+
+// Run the SMC reads on their own low-priority task (0 = inline in loop(),
+// the old blocking behaviour). The task sits on the core not running loop().
+#ifndef RGBSMBUS_TASK
+#define RGBSMBUS_TASK 1
+#endif
+#ifndef RGBSMBUS_TASK_CORE
+  #if CONFIG_FREERTOS_UNICORE
+    #define RGBSMBUS_TASK_CORE 0
+  #else
+    #define RGBSMBUS_TASK_CORE (ARDUINO_RUNNING_CORE ? 0 : 1)
+  #endif
+#endif
+#ifndef RGBSMBUS_TASK_PRIO
+#define RGBSMBUS_TASK_PRIO 1
+#endif
+// A read that hasn't reported back after this long is given up on.
+#ifndef RGBSMBUS_JOB_TIMEOUT_MS
+#define RGBSMBUS_JOB_TIMEOUT_MS 1000
+#endif
+
+// Sensors in the batch (bit = RGBsmbus::Sensor). CPU/FAN are read while their
+// bar is on; any sensor is read while RGBsmbus::sensor() was asked for it in
+// the last RGBSMBUS_WANT_MS.
+#ifndef RGBSMBUS_SENSOR_MASK
+#define RGBSMBUS_SENSOR_MASK 0x1F
+#endif
+#ifndef RGBSMBUS_WANT_MS
+#define RGBSMBUS_WANT_MS 30000
+#endif
+// Board temp / tray / AV pack interval (CPU/FAN use the adaptive scheduler).
+#ifndef RGBSMBUS_EXTRA_MS
+#define RGBSMBUS_EXTRA_MS 8000
+#endif
+// A read due within this long rides along with the one that is due now.
+#ifndef RGBSMBUS_BATCH_AHEAD_MS
+#define RGBSMBUS_BATCH_AHEAD_MS 1000
+#endif
+
+// Listen-only mode: never drive XSDA/XSCL, decode the Xbox's own SMC reads
+// of 0x09/0x10 instead (safe next to a Type-D expansion). Bars blank when
+// nothing has been heard for RGBSMBUS_SNIFF_STALE_MS.
+#ifndef RGBSMBUS_SNIFF
+#define RGBSMBUS_SNIFF 0
+#endif
+#ifndef RGBSMBUS_SNIFF_STALE_MS
+#define RGBSMBUS_SNIFF_STALE_MS 30000
+#endif
+
+// A value older than this is reported stale (and its bar blanked).
+#ifndef RGBSMBUS_SENSOR_STALE_MS
+  #if RGBSMBUS_SNIFF
+    #define RGBSMBUS_SENSOR_STALE_MS RGBSMBUS_SNIFF_STALE_MS
+  #else
+    #define RGBSMBUS_SENSOR_STALE_MS 45000
+  #endif
+#endif
 // ===============================================================
 
 namespace RGBsmbus {
@@ -147,7 +256,13 @@ static uint8_t CH6_COUNT = 5;
 static Adafruit_NeoPixel cpuStrip(5, 1, RGBSMBUS_PIXEL_TYPE);
 static Adafruit_NeoPixel fanStrip(5, 2, RGBSMBUS_PIXEL_TYPE);
 
-static uint32_t nextPoll     = 0;
+// ---------- Stats (see statsJson) ----------
+static uint32_t statAttempts = 0;   // single-byte reads started
+static uint32_t statOk       = 0;   // ... that returned a byte
+static uint32_t statBusy     = 0;   // ... skipped: bus not idle/quiet or lock busy
+static RGBstats::Hist statWaitIdle;
+static RGBstats::Acc  statShow[2];  // CH5, CH6
+
 static float    smoothedCpu  = 0.0f;
 static float    smoothedFan  = 0.0f;
 
@@ -157,12 +272,63 @@ static bool gEnableFAN   = true;
 static bool gIsXcalibur  = false;
 static bool gBoardDetected = false;  // probe once, when safe
 
-// last applied brightness
-static uint8_t lastAppliedBrightnessCpu = 0xFF;
-static uint8_t lastAppliedBrightnessFan = 0xFF;
-
-// Round-robin step: 0=CPU, 1=FAN, 2=idle, 3=idle → repeat
-static uint8_t rr_step = 0;
+// ---------- Bars (drawn in RGBCtrl's frame, see renderBars) ----------
+// loop() only sets a target per bar (0 = CH5/CPU, 1 = CH6/FAN); the renderer
+// eases the shown fill and colour toward it every frame and sends CH5/CH6 in
+// the same output window as CH1..CH4.
+static std::atomic<uint32_t> barTarget[2];   // rgb:24 << 8 | fill in 1/16 LED
+static std::atomic<bool>     barFail[2];     // flag pixel 0 until the next reading
+static std::atomic<bool>     barsReady{false};
+struct BarView { float fill, r, g, b; };     // renderer only
+static BarView barView[2] = {};
+
+// ---------- SMC reader hand-off ----------
+// loop() posts one batch (a mask of sensors) at a time. The reader (task,
+// or inline) publishes each raw byte as one atomic word per sensor, then
+// the batch outcome; loop() picks them up by sequence number, converts, and
+// republishes the value for sensor(). No locks between the sides.
+enum : uint8_t { RD_OK = 1, RD_FAIL = 2, RD_BUSY = 3, RD_BLOCKED = 4 };
+
+static const uint8_t SENSOR_REG[SENSOR_COUNT] = {
+  REG_CPUTEMP, REG_BOARDTEMP, REG_FANSPEED, REG_TRAY, REG_AVPACK
+};
+static const char* const SENSOR_KEY[SENSOR_COUNT] = { "cpu", "board", "fan", "tray", "av" };
+
+struct SensorCache {
+  std::atomic<uint32_t> word{0};     // reader -> loop(): seq:16 | status:8 | raw:8
+  std::atomic<uint32_t> value{0};    // loop() -> sensor(): valid:1 << 8 | value:8
+  std::atomic<uint32_t> atMs{0};     // when value was read
+  std::atomic<uint32_t> wantMs{0};   // last sensor() call, 0 = never
+};
+static SensorCache cache[SENSOR_COUNT];
+static std::atomic<uint8_t>  jobReq{0};       // mask of sensors to read
+static std::atomic<uint32_t> jobDone{0};      // seq:16 | status:8
+static std::atomic<uint32_t> jobCostUs{0};    // reader time spent on that batch
+static TaskHandle_t smcTask = nullptr;
+static void smcTaskMain(void*);
+static void sniffBegin();
+
+// SDA edges while waitBusIdle() has the interrupt armed.
+static volatile uint32_t busEdges = 0;
+static void IRAM_ATTR onBusEdge() { ++busEdges; }
+
+// ---------- Adaptive poll scheduler ----------
+struct SensorSched {
+  uint32_t dueMs;        // next read (millis)
+  uint32_t intervalMs;   // current interval
+  float    last;         // last accepted raw reading
+  bool     valid;        // last is meaningful
+  uint8_t  fails;        // consecutive failed reads
+};
+static SensorSched sched[SENSOR_COUNT];
+static uint8_t  busFails    = 0;     // consecutive ticks with a busy bus
+static uint32_t checkMs     = 0;     // flags/guard re-check when nothing is due
+static uint32_t tickCostUs  = RGBSMBUS_GUARD_PER_POLL_US;   // last tick's bus time
+static int32_t  budgetUs    = RGBSMBUS_BUS_BURST_US;       // banked bus time
+static uint32_t budgetLastMs = 0;
+static uint32_t statDeferred = 0;    // reads held back by the budget
+static bool     deferring    = false;
+static uint32_t statBusUs    = 0;    // total bus time spent (µs)
 
 // -------- Type-D Expansion guard (UDP presence beacon) --------
 static WiFiUDP guardUdp;
@@ -179,8 +345,55 @@ static inline unsigned long jitter_ms(unsigned long maxJ) {
   return (millis() ^ 0xA5A5u) % (maxJ + 1);
 }
 
-static void armNextPoll(uint32_t base_ms = RGBSMBUS_POLL_MS) {
-  nextPoll = millis() + base_ms + jitter_ms(RGBSMBUS_JITTER_MAX_MS);
+static inline bool dueNow(uint32_t due, uint32_t now) { return (int32_t)(now - due) >= 0; }
+
+static void schedReset(SensorSched& s, uint32_t now) {
+  s.intervalMs = RGBSMBUS_POLL_MS;
+  s.dueMs = now;
+  s.valid = false;
+  s.fails = 0;
+}
+
+// min(RGBSMBUS_POLL_MAX_MS, RGBSMBUS_POLL_MIN_MS << n)
+static uint32_t backoffMs(uint8_t n) {
+  uint32_t ms = RGBSMBUS_POLL_MIN_MS;
+  while (n-- && ms < RGBSMBUS_POLL_MAX_MS) ms <<= 1;
+  return ms < RGBSMBUS_POLL_MAX_MS ? ms : RGBSMBUS_POLL_MAX_MS;
+}
+
+// After a good read: fast while the value moves (or the EMA is still
+// catching up), exponential back-off while it holds still.
+static void schedReading(SensorSched& s, float raw, float smoothed, float step, bool near, uint32_t now) {
+  const bool moving = !s.valid || fabsf(raw - s.last) >= step || fabsf(raw - smoothed) >= step;
+  s.last = raw; s.valid = true; s.fails = 0;
+  if (moving) s.intervalMs = RGBSMBUS_POLL_MIN_MS;
+  else        s.intervalMs = s.intervalMs * 2 > RGBSMBUS_POLL_MAX_MS ? RGBSMBUS_POLL_MAX_MS : s.intervalMs * 2;
+  if (near && s.intervalMs > RGBSMBUS_POLL_NEAR_MS) s.intervalMs = RGBSMBUS_POLL_NEAR_MS;
+  s.dueMs = now + s.intervalMs + jitter_ms(RGBSMBUS_JITTER_MAX_MS);
+}
+
+static void schedFailed(SensorSched& s, uint32_t now) {
+  if (s.fails < 8) ++s.fails;
+  s.intervalMs = backoffMs(s.fails);
+  s.dueMs = now + s.intervalMs + jitter_ms(RGBSMBUS_JITTER_MAX_MS);
+}
+
+static inline bool nearCpuThreshold(float c) {
+  return fabsf(c - CPU_COOL_MAX_C) < RGBSMBUS_CPU_NEAR_C ||
+         fabsf(c - CPU_WARM_MAX_C) < RGBSMBUS_CPU_NEAR_C ||
+         c > CPU_MAX_C - RGBSMBUS_CPU_NEAR_C;
+}
+static inline bool nearFanThreshold(float p) {
+  return fabsf(p - FAN_SLOW_MAX) < RGBSMBUS_FAN_NEAR_PCT ||
+         fabsf(p - FAN_MED_MAX)  < RGBSMBUS_FAN_NEAR_PCT;
+}
+
+// Token bucket for bus time: refills at RGBSMBUS_BUS_BUDGET_US_PER_S.
+static void budgetRefill(uint32_t now) {
+  const uint32_t dt = now - budgetLastMs;
+  budgetLastMs = now;
+  int64_t b = (int64_t)budgetUs + (int64_t)dt * RGBSMBUS_BUS_BUDGET_US_PER_S / 1000;
+  budgetUs = b > RGBSMBUS_BUS_BURST_US ? RGBSMBUS_BUS_BURST_US : (int32_t)b;
 }
 
 static void markTypeDSeen() {
@@ -248,28 +461,17 @@ static uint32_t colorForFan(float p) {
   }
   return FAN_FAST_COLOR;
 }
-static uint8_t barLen(float val, float maxVal, uint8_t n) {
-  if (maxVal <= 0.f) return 0;
-  float f = clampf(val/maxVal, 0.f, 1.f);
-  int lit = int(f*n + 0.5f);
-  if (lit < 0) lit = 0; if (lit > (int)n) lit = n;
-  return (uint8_t)lit;
-}
-static void drawBar(Adafruit_NeoPixel& strip,
-                    uint8_t& lastBriRef,
-                    uint8_t nleds,
-                    uint8_t lit,
-                    uint32_t rgb24) {
-  const uint8_t r=(rgb24>>16)&0xFF, g=(rgb24>>8)&0xFF, b=rgb24&0xFF;
+static inline uint8_t barCount(uint8_t b) { return b ? CH6_COUNT : CH5_COUNT; }
 
-  for (uint8_t i=0;i<nleds;++i)
-    strip.setPixelColor(i, (i<lit)?r:0, (i<lit)?g:0, (i<lit)?b:0);
-
-  if (lastBriRef != BRIGHTNESS) {
-    strip.setBrightness(BRIGHTNESS);
-    lastBriRef = BRIGHTNESS;
-  }
-  strip.show();
+static void setBar(uint8_t b, float val, float maxVal, uint32_t rgb24) {
+  const float f = maxVal > 0.f ? clampf(val / maxVal, 0.f, 1.f) : 0.f;
+  barTarget[b].store((rgb24 << 8) | (uint8_t)(f * barCount(b) * 16.f + 0.5f), std::memory_order_relaxed);
+  barFail[b].store(false, std::memory_order_relaxed);
+}
+// Empty the bar (it drains at the ease rate, in its last colour).
+static void blankBar(uint8_t b) {
+  barTarget[b].store(barTarget[b].load(std::memory_order_relaxed) & 0xFFFFFF00u, std::memory_order_relaxed);
+  barFail[b].store(false, std::memory_order_relaxed);
 }
 
 // ---------- SMBus / Wire helpers ----------
@@ -307,17 +509,38 @@ static bool waitBusIdle(uint8_t sda, uint8_t scl,
                         uint32_t timeout_ms = RGBSMBUS_WAIT_IDLE_MS,
                         int stable_needed = RGBSMBUS_IDLE_STABLE) {
   uint32_t start = millis();
+  const uint32_t t0 = micros();
+
+  // On the reader task: count SDA edges with an interrupt that is only armed
+  // while we wait, and sleep a tick between checks instead of sampling. Idle
+  // = both lines high and no SDA edge for a whole tick (>= the ~0.85 ms of
+  // stable samples the polled path asks for).
+  if (smcTask && xTaskGetCurrentTaskHandle() == smcTask) {
+    const uint8_t irq = digitalPinToInterrupt(sda);
+    attachInterrupt(irq, onBusEdge, CHANGE);
+    bool idle = false;
+    while (!idle && (millis() - start) < timeout_ms) {
+      const uint32_t e0 = busEdges;
+      vTaskDelay(1);
+      idle = busEdges == e0 && digitalRead(sda) == HIGH && digitalRead(scl) == HIGH;
+    }
+    detachInterrupt(irq);
+    statWaitIdle.note(micros() - t0);
+    return idle;
+  }
+
   int stable = 0;
   while ((millis() - start) < timeout_ms) {
     bool sdaHigh = digitalRead(sda) == HIGH;
     bool sclHigh = digitalRead(scl) == HIGH;
     if (sdaHigh && sclHigh) {
-      if (++stable >= stable_needed) return true;
+      if (++stable >= stable_needed) { statWaitIdle.note(micros() - t0); return true; }
     } else {
       stable = 0;
     }
     delayMicroseconds(140);
   }
+  statWaitIdle.note(micros() - t0);
   return false;
 }
 
@@ -349,11 +572,12 @@ static bool readByteSTOP(uint8_t addr7, uint8_t reg, uint8_t& value) {
   ensureWireReady();
   if (!gWireReady) return false;
 
+  ++statAttempts;
   RGBCtrlUDP::enterSmbusQuietUs(RGBSMBUS_GUARD_PER_ATTEMPT_US);
-  if (!waitBusIdle(PINS.sda, PINS.scl)) return false;
-  if (!quietSinceLastPollerTouch())     return false;
+  if (!waitBusIdle(PINS.sda, PINS.scl)) { ++statBusy; return false; }
+  if (!quietSinceLastPollerTouch())     { ++statBusy; return false; }
 
-  if (!smbus_acquire(5)) return false;
+  if (!smbus_acquire(5)) { ++statBusy; return false; }
 
   Wire.beginTransmission(addr7);
   Wire.write(reg);
@@ -366,6 +590,7 @@ static bool readByteSTOP(uint8_t addr7, uint8_t reg, uint8_t& value) {
 
   bool good = (ok && n == 1 && Wire.available());
   if (good) {
+    ++statOk;
     value = Wire.read();
     smbus_note_activity();
   }
@@ -383,11 +608,12 @@ static bool readByteRS(uint8_t addr7, uint8_t reg, uint8_t& value) {
   ensureWireReady();
   if (!gWireReady) return false;
 
+  ++statAttempts;
   RGBCtrlUDP::enterSmbusQuietUs(RGBSMBUS_GUARD_PER_ATTEMPT_US);
-  if (!waitBusIdle(PINS.sda, PINS.scl)) return false;
-  if (!quietSinceLastPollerTouch())     return false;
+  if (!waitBusIdle(PINS.sda, PINS.scl)) { ++statBusy; return false; }
+  if (!quietSinceLastPollerTouch())     { ++statBusy; return false; }
 
-  if (!smbus_acquire(5)) return false;
+  if (!smbus_acquire(5)) { ++statBusy; return false; }
 
   Wire.beginTransmission(addr7);
   Wire.write(reg);
@@ -400,6 +626,7 @@ static bool readByteRS(uint8_t addr7, uint8_t reg, uint8_t& value) {
   int n = Wire.requestFrom((int)addr7, 1, (int)true); // STOP
   bool good = (n == 1 && Wire.available());
   if (good) {
+    ++statOk;
     value = Wire.read();
     smbus_note_activity();
   }
@@ -440,20 +667,31 @@ static bool readMedianByte(uint8_t addr7, uint8_t reg, uint8_t& out) {
   return true;
 }
 
-static bool readCpuCelsius(uint8_t& outC) {
-  uint8_t v=0;
-  if (!readMedianByte(SMC_ADDRESS, REG_CPUTEMP, v)) return false;
+static bool cpuFromRaw(uint8_t v, uint8_t& outC) {
   if (v > 100) return false;     // plausibility guard (0..100 °C)
   outC = v;
   return true;
 }
-static bool readFanPercent(uint8_t& outPct) {
-  uint8_t v=0;
-  if (!readMedianByte(SMC_ADDRESS, REG_FANSPEED, v)) return false;
+static uint8_t fanFromRaw(uint8_t v) {
   uint16_t pct = (v <= 50) ? (uint16_t)v * 2u : (uint16_t)v; // 0..50 → %
-  if (pct > 100) pct = 100;
-  outPct = (uint8_t)pct;
-  return true;
+  return pct > 100 ? 100 : (uint8_t)pct;
+}
+
+// Raw register byte for one sensor: median for the analogue ones, a single
+// read for the state bytes (a median of an enum means nothing).
+static bool readSensorRaw(uint8_t s, uint8_t& raw) {
+  if (s == SENSOR_TRAY || s == SENSOR_AV) return readOncePrefStop(SMC_ADDRESS, SENSOR_REG[s], raw);
+  return readMedianByte(SMC_ADDRESS, SENSOR_REG[s], raw);
+}
+
+// Raw byte -> reported value; false if implausible.
+static bool convertRaw(uint8_t s, uint8_t raw, uint8_t& out) {
+  switch (s) {
+    case SENSOR_CPU_C:
+    case SENSOR_BOARD_C: return cpuFromRaw(raw, out);
+    case SENSOR_FAN_PCT: out = fanFromRaw(raw); return true;
+    default:             out = raw; return true;
+  }
 }
 
 // Probe for encoder (optional)
@@ -478,11 +716,11 @@ static void detectBoardLazy() {
 static void applyEnableFlags(bool wantCPU, bool wantFAN) {
   if (gEnableCPU != wantCPU) {
     gEnableCPU = wantCPU;
-    if (!gEnableCPU && CH5_COUNT) drawBar(cpuStrip, lastAppliedBrightnessCpu, CH5_COUNT, 0, 0);
+    if (!gEnableCPU) blankBar(0);
   }
   if (gEnableFAN != wantFAN) {
     gEnableFAN = wantFAN;
-    if (!gEnableFAN && CH6_COUNT) drawBar(fanStrip, lastAppliedBrightnessFan, CH6_COUNT, 0, 0);
+    if (!gEnableFAN) blankBar(1);
   }
 }
 
@@ -498,8 +736,14 @@ void begin(const RGBsmbusPins& pins, uint8_t ch5Count, uint8_t ch6Count) {
   cpuStrip.begin(); cpuStrip.clear(); cpuStrip.setBrightness(BRIGHTNESS); cpuStrip.show();
   fanStrip.begin(); fanStrip.clear(); fanStrip.setBrightness(BRIGHTNESS); fanStrip.show();
 
-  lastAppliedBrightnessCpu = BRIGHTNESS;
-  lastAppliedBrightnessFan = BRIGHTNESS;
+#if RGBSMBUS_ASYNC_OUT
+  RGBout::attach(cpuStrip);
+  RGBout::attach(fanStrip);
+#else
+  RGBout::track(cpuStrip);
+  RGBout::track(fanStrip);
+#endif
+  barsReady.store(true, std::memory_order_release);   // renderer may draw them now
 
   // Start with pins floated; Wire will init only when unguarded
   wirePinsToInput();
@@ -511,116 +755,397 @@ void begin(const RGBsmbusPins& pins, uint8_t ch5Count, uint8_t ch6Count) {
   // Start Type-D beacon listener
   guardUdp.begin(TYPE_D_PORT);
 
-  rr_step = 0;
-  nextPoll = 0;
+  const uint32_t now = millis();
+  for (uint8_t i=0; i<SENSOR_COUNT; ++i) schedReset(sched[i], now);
+  busFails = 0; checkMs = now;
+  budgetLastMs = now; budgetUs = RGBSMBUS_BUS_BURST_US;
+
+#if RGBSMBUS_SNIFF
+  sniffBegin();
+#elif RGBSMBUS_TASK && defined(ARDUINO_ARCH_ESP32)
+  if (!smcTask)
+    xTaskCreatePinnedToCore(smcTaskMain, "smbus", 3072, nullptr,
+                            RGBSMBUS_TASK_PRIO, &smcTask, RGBSMBUS_TASK_CORE);
+#endif
 }
 
-static void updateOnceRR() {
-  // Mirror UI flags each cycle
-  applyEnableFlags(RGBCtrl::smbusCpuEnabled(), RGBCtrl::smbusFanEnabled());
+// ---------- SMC reader ----------
+// Every Wire/pin access happens in runJob(). On the reader task the idle
+// wait sleeps and the median read's breathers only hold that task, so
+// loop() latency no longer depends on Xbox bus traffic. A batch shares one
+// quiet window, Wire check and idle wait; each byte still re-checks idle
+// before it starts (readByteSTOP), so the Xbox can't be talked over.
+static void IRAM_ATTR publish(SensorCache& c, uint8_t status, uint8_t raw) {
+  const uint32_t seq = ((c.word.load(std::memory_order_relaxed) >> 16) + 1) & 0xFFFF;
+  c.word.store((seq << 16) | ((uint32_t)status << 8) | raw, std::memory_order_release);
+}
 
-  // HARD guard path: blank bars, keep Wire down
-  if (smbusGuardedHard()) {
-    dropWireIfGuarded();
-    if (CH5_COUNT) drawBar(cpuStrip, lastAppliedBrightnessCpu, CH5_COUNT, 0, 0);
-    if (CH6_COUNT) drawBar(fanStrip, lastAppliedBrightnessFan, CH6_COUNT, 0, 0);
-    return;
-  }
+static void finishJob(uint8_t status, uint32_t costUs) {
+  const uint32_t seq = ((jobDone.load(std::memory_order_relaxed) >> 16) + 1) & 0xFFFF;
+  jobCostUs.store(costUs, std::memory_order_relaxed);
+  jobDone.store((seq << 16) | ((uint32_t)status << 8), std::memory_order_release);
+}
 
-  // If both disabled, ensure LEDs are off and skip the bus entirely
-  if (!gEnableCPU && !gEnableFAN) {
-    if (CH5_COUNT) drawBar(cpuStrip, lastAppliedBrightnessCpu, CH5_COUNT, 0, 0);
-    if (CH6_COUNT) drawBar(fanStrip, lastAppliedBrightnessFan, CH6_COUNT, 0, 0);
-    return;
-  }
+static void runJob(uint8_t mask) {
+  const uint32_t t0 = micros();
+
+  if (smbusGuardedHard()) { dropWireIfGuarded(); finishJob(RD_BLOCKED, 0); return; }
 
   // Safe, light probe once when allowed
   detectBoardLazy();
 
-  // Coarse quiet window for the whole RR step
-  RGBCtrlUDP::enterSmbusQuietUs(RGBSMBUS_GUARD_PER_POLL_US);
+  // Coarse quiet window for the whole batch
+  RGBCtrlUDP::enterSmbusQuietUs(RGBSMBUS_GUARD_PER_POLL_US * __builtin_popcount(mask));
 
   ensureWireReady();
-  if (!gWireReady) {
-    if (CH5_COUNT) drawBar(cpuStrip, lastAppliedBrightnessCpu, CH5_COUNT, 0, 0);
-    if (CH6_COUNT) drawBar(fanStrip, lastAppliedBrightnessFan, CH6_COUNT, 0, 0);
-    return;
-  }
+  if (!gWireReady) { finishJob(RD_BLOCKED, micros() - t0); return; }
 
   // Require idle lines AND spacing since last SMBus activity
   if (!waitBusIdle(PINS.sda, PINS.scl) || !quietSinceLastPollerTouch()) {
     maybeRecoverWire();
-    if (CH5_COUNT) drawBar(cpuStrip, lastAppliedBrightnessCpu, CH5_COUNT, 0, 0);
-    if (CH6_COUNT) drawBar(fanStrip, lastAppliedBrightnessFan, CH6_COUNT, 0, 0);
+    finishJob(RD_BUSY, micros() - t0);
     return;
   }
   s_stuckPolls = 0;
 
-  // Round-robin: only one read per tick to avoid bursts
-  const uint8_t step = (rr_step++) & 0x03;
-  bool ok = true;
-  int cpuC = -1;
-  int fanP = -1;
+  for (uint8_t i=0; i<SENSOR_COUNT; ++i) {
+    if (!(mask & (1u << i))) continue;
+    uint8_t raw = 0;
+    const bool ok = readSensorRaw(i, raw);
+    publish(cache[i], ok ? RD_OK : RD_FAIL, raw);
+  }
+  finishJob(RD_OK, micros() - t0);
+}
 
-  if (step == 0 && gEnableCPU) {
-    uint8_t v=0; ok = readCpuCelsius(v); if (ok) cpuC = (int)v;
-  } else if (step == 1 && gEnableFAN) {
-    uint8_t v=0; ok = readFanPercent(v); if (ok) fanP = (int)v;
-  } else {
-    // idle steps (2,3) → no SMBus I/O
-  }
-
-  if (ok) {
-    if (cpuC >= 0) {
-      smoothedCpu = SMOOTH_ALPHA * float(cpuC) + (1.f-SMOOTH_ALPHA)*smoothedCpu;
-      drawBar(cpuStrip, lastAppliedBrightnessCpu,
-              CH5_COUNT,
-              barLen(smoothedCpu, CPU_MAX_C, CH5_COUNT),
-              colorForCpu(smoothedCpu));
-    } else if (!gEnableCPU) {
-      drawBar(cpuStrip, lastAppliedBrightnessCpu, CH5_COUNT, 0, 0);
-    }
+static void smcTaskMain(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+    if (smbusGuardedHard()) dropWireIfGuarded();   // pins are only touched here
+    const uint8_t mask = jobReq.exchange(0);
+    if (mask) runJob(mask);
+  }
+}
 
-    if (fanP >= 0) {
-      smoothedFan = SMOOTH_ALPHA * float(fanP) + (1.f-SMOOTH_ALPHA)*smoothedFan;
-      drawBar(fanStrip, lastAppliedBrightnessFan,
-              CH6_COUNT,
-              barLen(smoothedFan, FAN_FAST_MAX, CH6_COUNT),
-              colorForFan(smoothedFan));
-    } else if (!gEnableFAN) {
-      drawBar(fanStrip, lastAppliedBrightnessFan, CH6_COUNT, 0, 0);
+// ---------- Passive sniffer (RGBSMBUS_SNIFF) ----------
+// Software I²C decoder on CHANGE interrupts of both lines; the pins stay
+// inputs. A byte is 8 data bits + ACK sampled on SCL rising; SDA moving
+// while SCL is high is START (falling) or STOP (rising). The kernel's read
+// is "W 0x20 reg [Sr|P S] R 0x21 value", so a one-byte write to the SMC
+// arms the register and the next SMC read supplies its value (any of the
+// batch registers the kernel or dashboard happens to read). A missed
+// edge (the ISR is late on a fast bus) only breaks framing: the address
+// won't match or the ACK is wrong, and the transaction is dropped.
+struct Sniff {
+  uint8_t  scl = 1, sda = 1;     // previous line levels
+  bool     inFrame = false;      // between START and STOP
+  uint8_t  bits = 0, shift = 0;  // bit count in the current byte (8 = ACK)
+  uint8_t  nbytes = 0;           // bytes in this transaction, address included
+  uint8_t  addr = 0, data = 0;   // address byte (8-bit), first data byte
+  uint8_t  reg = 0xFF;           // armed SMC register, 0xFF = none
+};
+static Sniff sn;
+static volatile uint32_t sniffFrames = 0;   // transactions decoded
+static volatile uint32_t sniffDropped = 0;  // ... abandoned (NACK / bad framing)
+static volatile uint32_t sniffHits = 0;     // sensor values overheard
+static volatile bool     sniffXcal = false; // something ACKed at I2C_XCALIBUR
+
+// Sensor for an SMC register, or -1 (immediates only: safe in the ISR).
+static inline int8_t IRAM_ATTR sensorForReg(uint8_t reg) {
+  switch (reg) {
+    case REG_CPUTEMP:   return SENSOR_CPU_C;
+    case REG_BOARDTEMP: return SENSOR_BOARD_C;
+    case REG_FANSPEED:  return SENSOR_FAN_PCT;
+    case REG_TRAY:      return SENSOR_TRAY;
+    case REG_AVPACK:    return SENSOR_AV;
+    default:            return -1;
+  }
+}
+
+static void IRAM_ATTR sniffEnd() {
+  if (!sn.inFrame || sn.nbytes == 0) return;
+  ++sniffFrames;
+  const uint8_t a7 = sn.addr >> 1;
+  const bool rd = sn.addr & 1;
+  if (a7 == I2C_XCALIBUR) sniffXcal = true;
+  if (a7 != SMC_ADDRESS) return;
+  if (!rd) { sn.reg = (sn.nbytes == 2) ? sn.data : 0xFF; return; }   // reg only = read setup
+  const int8_t i = (sn.nbytes >= 2 && sn.reg != 0xFF) ? sensorForReg(sn.reg) : -1;
+  if (i >= 0) { publish(cache[i], RD_OK, sn.data); ++sniffHits; }
+  sn.reg = 0xFF;
+}
+
+static void IRAM_ATTR onSniffEdge() {
+  const uint8_t scl = digitalRead(PINS.scl), sda = digitalRead(PINS.sda);
+  if (scl && sn.scl && sda != sn.sda) {             // START / Sr / STOP
+    sniffEnd();
+    sn.inFrame = !sda;
+    sn.bits = 0; sn.shift = 0; sn.nbytes = 0;
+  } else if (scl && !sn.scl && sn.inFrame) {        // clock a bit
+    if (sn.bits < 8) {
+      sn.shift = (sn.shift << 1) | sda; ++sn.bits;
+    } else {                                        // ACK slot
+      const bool ack = !sda;
+      if (sn.nbytes == 0) sn.addr = sn.shift;
+      else if (sn.nbytes == 1) sn.data = sn.shift;
+      // Address NACKed: nobody home. Data NACK is normal for a read's last byte.
+      if (sn.nbytes == 0 && !ack) { ++sniffDropped; sn.inFrame = false; }
+      else ++sn.nbytes;
+      sn.bits = 0; sn.shift = 0;
     }
+  }
+  sn.scl = scl; sn.sda = sda;
+}
+
+static void sniffBegin() {
+  wirePinsToInput();
+  sn = Sniff{};
+  sn.scl = digitalRead(PINS.scl); sn.sda = digitalRead(PINS.sda);
+  attachInterrupt(digitalPinToInterrupt(PINS.scl), onSniffEdge, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(PINS.sda), onSniffEdge, CHANGE);
+}
+
+// ---------- Scheduler (loop() side) ----------
+static uint8_t  inFlight   = 0;          // mask posted, batch outcome not seen yet
+static uint32_t inFlightMs = 0;
+static uint16_t seenSeq[SENSOR_COUNT] = {};
+static uint16_t seenJob    = 0;
+static bool     barStale[2] = {false, false};   // CH5, CH6 blanked for old data
+
+static void blankBars() {
+  blankBar(0);
+  blankBar(1);
+}
+
+// Wanted right now: in the mask, and its bar is on or someone asked lately.
+static bool sensorActive(uint8_t i, uint32_t now) {
+  if (!(RGBSMBUS_SENSOR_MASK & (1u << i))) return false;
+  if (i == SENSOR_CPU_C && gEnableCPU) return true;
+  if (i == SENSOR_FAN_PCT && gEnableFAN) return true;
+  const uint32_t w = cache[i].wantMs.load(std::memory_order_relaxed);
+  return w && now - w < RGBSMBUS_WANT_MS;
+}
+
+// Mirror UI flags; false (bars blanked, schedules parked until the next
+// check) when the guard or the flags leave nothing to read.
+static bool readsAllowed(uint32_t now) {
+  applyEnableFlags(RGBCtrl::smbusCpuEnabled(), RGBCtrl::smbusFanEnabled());
+  bool any = false;
+  for (uint8_t i=0; i<SENSOR_COUNT; ++i) any |= sensorActive(i, now);
+  if (smbusGuardedHard() || !any) {
+    if (!smcTask) dropWireIfGuarded();         // the task does this itself
+    blankBars();
+    for (uint8_t i=0; i<SENSOR_COUNT; ++i) schedReset(sched[i], checkMs);   // start fresh once unblocked
+    return false;
+  }
+  return true;
+}
+
+// One sensor's raw byte from the reader or the sniffer.
+static void applyValue(uint8_t i, uint8_t status, uint8_t raw, uint32_t now) {
+  uint8_t v = 0;
+  if (status != RD_OK || !convertRaw(i, raw, v)) {
+    schedFailed(sched[i], now);
+    // Error blink on first pixel of an *enabled* bar
+    if (i == SENSOR_CPU_C && gEnableCPU) barFail[0].store(true, std::memory_order_relaxed);
+    if (i == SENSOR_FAN_PCT && gEnableFAN) barFail[1].store(true, std::memory_order_relaxed);
+    return;
+  }
+  cache[i].atMs.store(now, std::memory_order_relaxed);
+  cache[i].value.store(0x100u | v, std::memory_order_release);
+
+  if (i == SENSOR_CPU_C) {
+    smoothedCpu = SMOOTH_ALPHA * float(v) + (1.f-SMOOTH_ALPHA)*smoothedCpu;
+    schedReading(sched[i], float(v), smoothedCpu, RGBSMBUS_CPU_STEP_C, nearCpuThreshold(smoothedCpu), now);
+    if (!gEnableCPU) return;                   // read for sensor() only
+    barStale[0] = false;
+    setBar(0, smoothedCpu, CPU_MAX_C, colorForCpu(smoothedCpu));
+  } else if (i == SENSOR_FAN_PCT) {
+    smoothedFan = SMOOTH_ALPHA * float(v) + (1.f-SMOOTH_ALPHA)*smoothedFan;
+    schedReading(sched[i], float(v), smoothedFan, RGBSMBUS_FAN_STEP_PCT, nearFanThreshold(smoothedFan), now);
+    if (!gEnableFAN) return;
+    barStale[1] = false;
+    setBar(1, smoothedFan, FAN_FAST_MAX, colorForFan(smoothedFan));
   } else {
-    // Error blink on first pixel of *enabled* bars
-    if (gEnableCPU && CH5_COUNT) {
-      cpuStrip.setPixelColor(0,(FAIL_COLOR>>16)&0xFF,(FAIL_COLOR>>8)&0xFF,FAIL_COLOR&0xFF);
-      if (lastAppliedBrightnessCpu != BRIGHTNESS) { cpuStrip.setBrightness(BRIGHTNESS); lastAppliedBrightnessCpu = BRIGHTNESS; }
-      cpuStrip.show();
-    }
-    if (gEnableFAN && CH6_COUNT) {
-      fanStrip.setPixelColor(0,(FAIL_COLOR>>16)&0xFF,(FAIL_COLOR>>8)&0xFF,FAIL_COLOR&0xFF);
-      if (lastAppliedBrightnessFan != BRIGHTNESS) { fanStrip.setBrightness(BRIGHTNESS); lastAppliedBrightnessFan = BRIGHTNESS; }
-      fanStrip.show();
-    }
+    sched[i].fails = 0;
+    sched[i].dueMs = now + RGBSMBUS_EXTRA_MS + jitter_ms(RGBSMBUS_JITTER_MAX_MS);
   }
 }
 
+// The batch outcome: budget, and the whole-bus cases (busy / blocked).
+static void applyJob(uint8_t status, uint32_t costUs, uint32_t now) {
+  const uint8_t mask = inFlight;
+  inFlight = 0;
+  if (costUs) tickCostUs = costUs;
+  budgetUs -= (int32_t)costUs;
+  statBusUs += costUs;
+
+  if (status == RD_BLOCKED) {                  // guard latched / Wire not up
+    blankBars();
+    for (uint8_t i=0; i<SENSOR_COUNT; ++i)
+      if (mask & (1u << i)) sched[i].dueMs = now + RGBSMBUS_POLL_MS + jitter_ms(RGBSMBUS_JITTER_MAX_MS);
+    return;
+  }
+  if (status == RD_BUSY) {
+    // A bus that keeps looking busy pushes every sensor back exponentially.
+    if (busFails < 8) ++busFails;
+    const uint32_t backoff = backoffMs(busFails);
+    for (uint8_t i=0; i<SENSOR_COUNT; ++i)
+      if (!dueNow(now + backoff, sched[i].dueMs)) sched[i].dueMs = now + backoff;
+    blankBars();
+    return;
+  }
+  busFails = 0;
+}
+
+// Batch outcome first: once it is visible, so is every value published
+// before it, and none of those sensors is re-posted as still due.
+static void collect(uint32_t now) {
+  const uint32_t j = jobDone.load(std::memory_order_acquire);
+  const bool done = (uint16_t)(j >> 16) != seenJob;
+  for (uint8_t i=0; i<SENSOR_COUNT; ++i) {
+    const uint32_t w = cache[i].word.load(std::memory_order_acquire);
+    if ((uint16_t)(w >> 16) == seenSeq[i]) continue;
+    seenSeq[i] = (uint16_t)(w >> 16);
+    applyValue(i, (uint8_t)(w >> 8), (uint8_t)w, now);
+  }
+  if (done) {
+    seenJob = (uint16_t)(j >> 16);
+    applyJob((uint8_t)(j >> 8), jobCostUs.load(std::memory_order_relaxed), now);
+  }
+}
+
+// Blank a bar whose value went stale (reads failing, or nothing overheard).
+static void checkStaleBars(uint32_t now) {
+  for (uint8_t b=0; b<2; ++b) {
+    const uint8_t i = b ? SENSOR_FAN_PCT : SENSOR_CPU_C;
+    if (barStale[b] || !(b ? gEnableFAN : gEnableCPU)) continue;
+    if (!(cache[i].value.load(std::memory_order_relaxed) & 0x100u)) continue;   // never shown
+    if (now - cache[i].atMs.load(std::memory_order_relaxed) < RGBSMBUS_SENSOR_STALE_MS) continue;
+    barStale[b] = true;
+    blankBar(b);
+  }
+}
+
+static void postJob(uint8_t mask, uint32_t now) {
+  inFlight = mask; inFlightMs = now;
+  if (smcTask) { jobReq.store(mask); xTaskNotifyGive(smcTask); }
+  else         runJob(mask);                   // inline: results are collected next loop()
+}
+
+// Active sensors to read now: 0 unless one is due, then every active sensor
+// due within RGBSMBUS_BATCH_AHEAD_MS rides along in the same bus window.
+static uint8_t pickBatch(uint32_t now) {
+  uint8_t mask = 0; bool anyDue = false;
+  for (uint8_t i=0; i<SENSOR_COUNT; ++i) {
+    if (!sensorActive(i, now)) continue;
+    if (dueNow(sched[i].dueMs, now)) anyDue = true;
+    if (dueNow(sched[i].dueMs, now + RGBSMBUS_BATCH_AHEAD_MS)) mask |= 1u << i;
+  }
+  return anyDue ? mask : 0;
+}
+
 void loop() {
   // Always keep guard presence fresh
   pollTypeD();
 
-  // If a guard has (re)latched, ensure Wire stays down
-  if (smbusGuardedHard()) dropWireIfGuarded();
+  const uint32_t now = millis();
+#if RGBSMBUS_SNIFF
+  // Listen-only: nothing to schedule, just apply what was overheard.
+  applyEnableFlags(RGBCtrl::smbusCpuEnabled(), RGBCtrl::smbusFanEnabled());
+  if (sniffXcal) gIsXcalibur = true;
+  collect(now);
+  checkStaleBars(now);
+  return;
+#endif
 
+  // If a guard has (re)latched, ensure Wire stays down (the task does this)
+  if (!smcTask && smbusGuardedHard()) dropWireIfGuarded();
+
+  budgetRefill(now);
+  collect(now);
+  checkStaleBars(now);
+  if (inFlight) {
+    if (now - inFlightMs < RGBSMBUS_JOB_TIMEOUT_MS) return;
+    inFlight = 0;                              // lost/stuck batch: schedule anew
+  }
+
+  const uint8_t batch = pickBatch(now);
+  if (!batch) {
+    if (!dueNow(checkMs, now)) return;         // still mirror flags/guard now and then
+  } else if (budgetUs < (int32_t)tickCostUs) {
+    if (!deferring) { deferring = true; ++statDeferred; }   // over budget: bank more
+    return;
+  }
+  deferring = false;
+  checkMs = now + RGBSMBUS_POLL_MS + jitter_ms(RGBSMBUS_JITTER_MAX_MS);
+  if (!readsAllowed(now) || !batch) return;
+  postJob(batch, now);
+}
+
+// Manual refresh hook: read every active sensor now, budget aside.
+void refreshNow() {
+  if (RGBSMBUS_SNIFF) return;                  // listen-only: nothing to ask for
   const uint32_t now = millis();
-  if (now >= nextPoll) {
-    updateOnceRR();
-    armNextPoll();
+  if (inFlight || !readsAllowed(now)) return;
+  for (uint8_t i=0; i<SENSOR_COUNT; ++i) sched[i].dueMs = now;
+  const uint8_t batch = pickBatch(now);
+  if (batch) postJob(batch, now);
+}
+
+SensorValue sensor(Sensor s) {
+  SensorValue r{0, false, true, 0};
+  if (s >= SENSOR_COUNT) return r;
+  const uint32_t now = millis();
+  cache[s].wantMs.store(now | 1u, std::memory_order_relaxed);   // keep it polled
+  const uint32_t w = cache[s].value.load(std::memory_order_acquire);
+  if (!(w & 0x100u)) return r;
+  r.value = (uint8_t)w;
+  r.valid = true;
+  r.ageMs = now - cache[s].atMs.load(std::memory_order_relaxed);
+  r.stale = r.ageMs >= RGBSMBUS_SENSOR_STALE_MS;
+  return r;
+}
+
+// Ease the shown bars toward their targets. Settled bars land exactly on
+// the target so their frames repeat bit for bit and showIfChanged skips them.
+static inline void easeTo(float& v, float target, float a, float snap) {
+  v += (target - v) * a;
+  if (fabsf(target - v) < snap) v = target;
+}
+
+void renderBars(float dtMs) {
+  if (!barsReady.load(std::memory_order_acquire)) return;
+  const float a = dtMs >= RGBSMBUS_BAR_EASE_MS ? 1.f : dtMs / RGBSMBUS_BAR_EASE_MS;
+  for (uint8_t b=0; b<2; ++b) {
+    const uint8_t n = barCount(b);
+    if (!n) continue;
+    Adafruit_NeoPixel& strip = b ? fanStrip : cpuStrip;
+    const uint32_t t = barTarget[b].load(std::memory_order_relaxed);
+    BarView& v = barView[b];
+    easeTo(v.fill, (t & 0xFF) / 16.f, a, 0.01f);
+    easeTo(v.r, (t >> 24) & 0xFF, a, 0.5f);
+    easeTo(v.g, (t >> 16) & 0xFF, a, 0.5f);
+    easeTo(v.b, (t >>  8) & 0xFF, a, 0.5f);
+
+    // Whole LEDs lit, the leading one at its fractional share
+    for (uint8_t i=0; i<n; ++i) {
+      const float k = clampf(v.fill - i, 0.f, 1.f);
+      strip.setPixelColor(i, (uint8_t)(v.r * k), (uint8_t)(v.g * k), (uint8_t)(v.b * k));
+    }
+    if (barFail[b].load(std::memory_order_relaxed))   // error blink on first pixel
+      strip.setPixelColor(0,(FAIL_COLOR>>16)&0xFF,(FAIL_COLOR>>8)&0xFF,FAIL_COLOR&0xFF);
   }
 }
 
-// Manual refresh hook
-void refreshNow() { updateOnceRR(); }
+void showBars(bool asyncPass) {
+  if (!barsReady.load(std::memory_order_acquire)) return;
+  for (uint8_t b=0; b<2; ++b) {
+    Adafruit_NeoPixel& strip = b ? fanStrip : cpuStrip;
+    if (!barCount(b) || RGBout::isAsync(strip) != asyncPass) continue;
+    const uint32_t t0 = micros();
+    if (RGBout::showIfChanged(strip)) statShow[b].note(micros() - t0);
+  }
+}
 
 // Direct controls
 void setCpuEnabled(bool en) { applyEnableFlags(en, gEnableFAN); }
@@ -631,6 +1156,38 @@ bool fanEnabled() { return gEnableFAN; }
 bool isXcalibur() { return gIsXcalibur; }
 
 // Tiny REST API, including HARD guard inspection/clear
+void statsJson(JsonObject o) {
+  o["attempts"] = statAttempts;
+  o["ok"]       = statOk;
+  o["busy"]     = statBusy;
+  o["guarded"]  = smbusGuardedHard();
+  JsonObject sj = o.createNestedObject("sched");           // adaptive poll state
+  sj["cpuMs"]    = sched[SENSOR_CPU_C].intervalMs;
+  sj["fanMs"]    = sched[SENSOR_FAN_PCT].intervalMs;
+  sj["busFails"] = busFails;
+  sj["budgetUs"] = budgetUs;
+  sj["busUs"]    = statBusUs;
+  sj["deferred"] = statDeferred;
+  sj["task"]     = smcTask != nullptr;
+  if (RGBSMBUS_SNIFF) {
+    JsonObject sniff = o.createNestedObject("sniff");      // listen-only decoder
+    sniff["frames"]  = sniffFrames;
+    sniff["dropped"] = sniffDropped;
+    sniff["hits"]    = sniffHits;
+  }
+  JsonObject sv = o.createNestedObject("sensors");         // [value, ageMs]
+  for (uint8_t i=0; i<SENSOR_COUNT; ++i) {
+    const uint32_t w = cache[i].value.load(std::memory_order_relaxed);
+    if (!(w & 0x100u)) continue;
+    JsonArray e = sv.createNestedArray(SENSOR_KEY[i]);
+    e.add((uint8_t)w);
+    e.add(millis() - cache[i].atMs.load(std::memory_order_relaxed));
+  }
+  RGBstats::put(o.createNestedObject("waitIdle"), statWaitIdle);
+  JsonArray show = o.createNestedArray("show");           // CH5, CH6
+  for (uint8_t i=0; i<2; ++i) RGBstats::put(show.createNestedObject(), statShow[i]);
+}
+
 void attachWeb(AsyncWebServer& server, const char* basePath) {
   String base = (basePath && *basePath) ? basePath : "/config/smbus";
   String apiFlags  = base + "/api/flags";
@@ -639,7 +1196,7 @@ void attachWeb(AsyncWebServer& server, const char* basePath) {
   server.on(apiFlags.c_str(), HTTP_GET, [](AsyncWebServerRequest* r){
     bool cpuSaved = RGBCtrl::smbusCpuEnabled();
     bool fanSaved = RGBCtrl::smbusFanEnabled();
-    bool guarded  = smbusGuardedHard();
+    bool guarded  = smbusGuardedHard() && !RGBSMBUS_SNIFF;   // sniffing is never blocked
 
     bool cpuEff = guarded ? false : cpuSaved;
     bool fanEff = guarded ? false : fanSaved;
@@ -655,6 +1212,7 @@ void attachWeb(AsyncWebServer& server, const char* basePath) {
               (gGuardSticky||typeDPresentWindow())?"TypeD":"none",
               gGuardSticky?"true":"false",
               gIsXcalibur?"true":"false");
+    s->addHeader("Cache-Control", "no-store");
     r->send(s);
   });
 
@@ -714,7 +1272,7 @@ void attachWeb(AsyncWebServer& server, const char* basePath) {
     }
     applyEnableFlags(cpu, fan);
 
-    bool guarded  = smbusGuardedHard();
+    bool guarded  = smbusGuardedHard() && !RGBSMBUS_SNIFF;   // sniffing is never blocked
     bool cpuEff = guarded ? false : gEnableCPU;
     bool fanEff = guarded ? false : gEnableFAN;
 
@@ -2,6 +2,7 @@
 #include <Arduino.h>
 #include <Adafruit_NeoPixel.h>
 #include <ESPAsyncWebServer.h>
+#include <ArduinoJson.h>
 
 struct RGBsmbusPins {
   uint8_t ch5;   // WS2812 data pin for CH5 (CPU temp bar)
@@ -15,12 +16,41 @@ namespace RGBsmbus {
 // Initialize with pins and LED counts (max 10 per channel).
 void begin(const RGBsmbusPins& pins, uint8_t ch5Count = 10, uint8_t ch6Count = 10);
 
-// Call frequently in loop(); handles SMBus polling & LED updates.
+// Call frequently in loop(); handles SMBus polling and sets the bar targets
+// (RGBCtrl draws and sends the bars with each frame).
 void loop();
 
 // Optional: force an immediate SMBus poll & redraw.
 void refreshNow();
 
+// SMC values read in one batch per bus window (CPU/FAN also drive the
+// CH5/CH6 bars).
+enum Sensor : uint8_t {
+  SENSOR_CPU_C = 0,   // CPU temperature, °C
+  SENSOR_BOARD_C,     // board temperature, °C
+  SENSOR_FAN_PCT,     // fan speed, 0..100 %
+  SENSOR_TRAY,        // raw SMC tray state byte
+  SENSOR_AV,          // raw SMC A/V pack byte
+  SENSOR_COUNT
+};
+struct SensorValue {
+  uint8_t  value;
+  bool     valid;     // read at least once since boot
+  bool     stale;     // never read, or older than RGBSMBUS_SENSOR_STALE_MS
+  uint32_t ageMs;
+};
+
+// Latest value of a sensor: a few atomic loads, fine from any task or per
+// frame. Asking keeps that sensor in the batch for a while even with its bar
+// (or the bars) switched off.
+SensorValue sensor(Sensor s);
+
+// Frame hooks for RGBCtrl's renderer: ease the CH5/CH6 bars toward the
+// latest readings, then send them in the same output window as CH1..CH4
+// (async strips on the first pass, blocking ones on the second).
+void renderBars(float dtMs);
+void showBars(bool asyncPass);
+
 // Runtime enables
 void setCpuEnabled(bool en);
 void setFanEnabled(bool en);
@@ -32,4 +62,8 @@ bool fanEnabled();
 // POST <base>/api/flags   body {"cpu":bool,"fan":bool}
 void attachWeb(AsyncWebServer& server, const char* basePath = "/config/smbus");
 
+// Bus attempt/success/busy counters, idle-wait time and CH5/CH6 show()
+// time, for RGBCtrl's /api/stats.
+void statsJson(JsonObject o);
+
 } // namespace RGBsmbus
@@ -0,0 +1,78 @@
+#pragma once
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Always-on runtime counters shared by RGBCtrl, RGBCtrlUDP and RGBsmbus,
+// reported by GET <base>/api/stats and the UDP {"op":"stats"}. Updating one
+// is a handful of integer ops: no locks (each has a single writer; a reader
+// racing it only skews one sample) and no floats.
+namespace RGBstats {
+
+// Log2 latency histogram. b[0] counts samples < 16 µs, b[i] samples in
+// [8<<i, 16<<i) µs, and the last bucket everything >= 32 ms.
+struct Hist {
+  static const uint8_t BUCKETS = 13;
+  uint32_t n = 0, max = 0;
+  uint64_t sum = 0;
+  uint32_t b[BUCKETS] = {};
+
+  void note(uint32_t us) {
+    ++n; sum += us;
+    if (us > max) max = us;
+    uint8_t i = 0;
+    if (us >= 16) {
+      i = (uint8_t)(31 - __builtin_clz(us)) - 3;
+      if (i >= BUCKETS) i = BUCKETS - 1;
+    }
+    ++b[i];
+  }
+  uint32_t avg() const { return n ? (uint32_t)(sum / n) : 0; }
+};
+
+// Count / mean / max only, for per-mode and per-channel breakdowns.
+struct Acc {
+  uint32_t n = 0, max = 0;
+  uint64_t sum = 0;
+
+  void note(uint32_t us) { ++n; sum += us; if (us > max) max = us; }
+  uint32_t avg() const { return n ? (uint32_t)(sum / n) : 0; }
+};
+
+// Boot timeline: millis() at which each phase was first reached, 0 = not
+// yet. Marked from setup(), the network bring-up task and the renderer.
+enum BootPhase : uint8_t {
+  BOOT_SETUP,        // setup() entered
+  BOOT_CONFIG,       // saved config loaded
+  BOOT_LIGHT,        // first frame out with non-zero brightness
+  BOOT_FADE,         // boot fade finished
+  BOOT_WIFI,         // WiFiMgr up (portal / STA connect started)
+  BOOT_WEB,          // config routes attached
+  BOOT_UDP,          // UDP control + DDP listening
+  BOOT_STA,          // STA connected
+  BOOT_MDNS,         // mDNS started
+  BOOT_PHASES
+};
+inline uint32_t* bootTimes() { static uint32_t t[BOOT_PHASES] = {}; return t; }
+inline void bootMark(BootPhase p) {
+  uint32_t* t = bootTimes();
+  if (!t[p]) { const uint32_t ms = millis(); t[p] = ms ? ms : 1; }
+}
+
+inline void put(JsonObject o, const Hist& h) {
+  o["n"] = h.n; o["avg"] = h.avg(); o["max"] = h.max;
+  JsonArray a = o.createNestedArray("h");
+  for (uint8_t i=0; i<Hist::BUCKETS; ++i) a.add(h.b[i]);
+}
+
+inline void put(JsonObject o, const Acc& a) {
+  o["n"] = a.n; o["avg"] = a.avg(); o["max"] = a.max;
+}
+
+inline void putBoot(JsonObject o) {
+  static const char* const KEYS[BOOT_PHASES] = {
+    "setup", "config", "light", "fade", "wifi", "web", "udp", "sta", "mdns" };
+  const uint32_t* t = bootTimes();
+  for (uint8_t i=0; i<BOOT_PHASES; ++i) if (t[i]) o[KEYS[i]] = t[i];
+}
+
+} // namespace RGBstats
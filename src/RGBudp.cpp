@@ -2,7 +2,43 @@
 #include <WiFi.h>
 #include <WiFiUdp.h>
 #include <ArduinoJson.h>
+#include <Preferences.h>
+#include <esp_timer.h>
 #include "RGBCtrl.h"
+#include "RGBstats.h"
+#include "wifimgr.h"
+
+// DDP (Distributed Display Protocol) listener for realtime pixel streaming.
+// DDP packets are also accepted on the JSON control port. 0 disables the
+// dedicated port.
+#ifndef RGBUDP_DDP_PORT
+#define RGBUDP_DDP_PORT 4048
+#endif
+
+// JSON packets that arrive during an SMBus quiet window wait in this many
+// slots (each one packet buffer, ~1.6 KB).
+#ifndef RGBUDP_PEND_SLOTS
+#define RGBUDP_PEND_SLOTS 4
+#endif
+
+// Multi-unit sync: boot mode (0 off, 1 auto, 2 leader, 3 follow) until one
+// is set with {"op":"sync","mode":...}; beacon period and how long a
+// follower waits for a silent leader before (in auto) taking over.
+#ifndef RGBUDP_SYNC_DEFAULT
+#define RGBUDP_SYNC_DEFAULT 0
+#endif
+#ifndef RGBUDP_SYNC_BEACON_MS
+#define RGBUDP_SYNC_BEACON_MS 1000
+#endif
+#ifndef RGBUDP_SYNC_TIMEOUT_MS
+#define RGBUDP_SYNC_TIMEOUT_MS 3500
+#endif
+
+// Replies larger than this are refused rather than sent as an IP-fragmented
+// datagram (one Ethernet-sized payload).
+#ifndef RGBUDP_MAX_REPLY
+#define RGBUDP_MAX_REPLY 1400
+#endif
 
 namespace RGBCtrlUDP {
 
@@ -37,34 +73,317 @@ void enterSmbusQuietUs(uint32_t dur_us) {
 }
 
 // ---------- Pending / coalesced work (applied in tiny slices) ----------
-static bool     pendHasCfg     = false;
-static bool     pendIsSave     = false;   // true=save, false=preview
-static String   pendJson;                 // normalized cfg JSON
+static bool     pendHasCfg     = false;   // merged into RGBCtrl's staging copy
 
 static bool     pendHasCounts  = false;
 static uint16_t pendCounts[4]  = {0,0,0,0};
 
 static bool     pendDoReset    = false;
 
-// Raw packet deferral (avoid JSON parse during quiet window)
-static bool     pendHasRaw     = false;
-static IPAddress pendRawIp;
-static uint16_t  pendRawPort = 0;
-static size_t    pendRawLen  = 0;
-static char      pendRawBuf[sizeof(buf)];
+// Raw packet deferral (avoid JSON parse during quiet window).
+// Slots are taken in arrival order (seq). Policy per op:
+//  - preview: only the latest is kept; a newer one replaces it (and moves
+//    to the back, so it still lands after anything queued before it).
+//  - everything else (get/discover/save/...): never coalesced. If the queue
+//    is full, a queued preview is evicted to make room; failing that the
+//    new packet is refused with a "busy" reply.
+struct PendPkt {
+  bool      used = false;
+  bool      preview = false;
+  uint32_t  seq  = 0;
+  IPAddress ip;
+  uint16_t  port = 0;
+  size_t    len  = 0;
+  char      data[sizeof(buf)];
+};
+static PendPkt  pendQ[RGBUDP_PEND_SLOTS];
+static uint32_t pendSeq = 0;
+static uint8_t  pendDepth = 0, pendPeak = 0;
+static uint32_t pendQueued = 0, pendCoalesced = 0, pendDropped = 0, pendEarly = 0;
+
+// Receive counters (control port unless noted) and pending-work cost.
+static uint32_t rxJson = 0, rxPlain = 0, rxDdp = 0, rxBadJson = 0;
+static RGBstats::Hist statPending;           // processPending() calls that did work
 
 // Forward decl
 static void handleJsonPacket(const char* data, int len, IPAddress rip, uint16_t rport);
 
-// Time-boxed processor for pending heavy ops. One item per call.
+// ---------- DDP (binary pixel stream) ----------
+// Header (10 bytes, 14 with timecode), big endian:
+//   [0] flags  VV.T SRQP  (VV=01, T=timecode, R=reply, Q=query, P=push)
+//   [1] seq    low nibble, 1..15 (0 = not sequenced)
+//   [2] type   data type (RGB 8-bit assumed)
+//   [3] id     1/255 = whole ring, 2..5 = CH1..CH4, 251 = status (query)
+//   [4..7] data offset (bytes), [8..9] data length
+// Pixel data goes straight into RGBCtrl's stream buffer: no JSON, no String.
+#if RGBUDP_DDP_PORT
+static WiFiUDP  ddp;
+#endif
+static uint8_t  ddpBuf[1460];         // 14 header + 1440 data (DDP max)
+static uint8_t  ddpLastSeq = 0;
+static uint32_t ddpSeqGaps = 0;
+
+static const uint8_t DDP_VER1      = 0x40;
+static const uint8_t DDP_F_PUSH    = 0x01;
+static const uint8_t DDP_F_QUERY   = 0x02;
+static const uint8_t DDP_F_REPLY   = 0x04;
+static const uint8_t DDP_F_TIME    = 0x10;
+static const uint8_t DDP_ID_STATUS = 251;
+
+static inline bool looksLikeDdp(const uint8_t* p, int len) {
+  return len >= 10 && (p[0] & 0xC0) == DDP_VER1 && !(p[0] & DDP_F_REPLY);
+}
+
+// The control port also gets text, so a packet there only counts as DDP if
+// the whole header checks out: reserved bits clear (printable ASCII always
+// sets the seq byte's high nibble), an RGB data type, an id we serve, and a
+// declared length that matches the payload exactly.
+static bool isDdpPacket(const uint8_t* p, int len) {
+  if (!looksLikeDdp(p, len) || (p[0] & 0x20) || (p[1] & 0xF0)) return false;
+  const int hdr = (p[0] & DDP_F_TIME) ? 14 : 10;
+  if (len < hdr) return false;
+  const uint8_t  type = p[2], id = p[3];
+  const uint32_t dlen = ((uint32_t)p[8] << 8) | p[9];
+  if (p[0] & DDP_F_QUERY) return id == DDP_ID_STATUS && dlen == 0;
+  if (type != 0x00 && type != 0x01 && type != 0x0B) return false;   // undefined / RGB / RGB 8-bit
+  if (!(id == 1 || id == 255 || (id >= 2 && id <= 5))) return false;
+  return dlen == (uint32_t)(len - hdr);
+}
+
+static void ddpReplyStatus(WiFiUDP& sock, IPAddress ip, uint16_t port, uint8_t seq) {
+  char js[96];
+  const int n = snprintf(js, sizeof(js),
+    "{\"status\":{\"man\":\"Darkone Customs\",\"mod\":\"XBOX RGB\",\"ver\":\"1.4.x\"}}");
+  if (n <= 0) return;
+  uint8_t h[10] = { (uint8_t)(DDP_VER1 | DDP_F_REPLY | DDP_F_PUSH), seq, 0, DDP_ID_STATUS,
+                    0, 0, 0, 0, (uint8_t)(n >> 8), (uint8_t)n };
+  sock.beginPacket(ip, port);
+  sock.write(h, sizeof(h));
+  sock.write((const uint8_t*)js, (size_t)n);
+  sock.endPacket();
+}
+
+static void handleDdp(WiFiUDP& sock, const uint8_t* p, int len, IPAddress rip, uint16_t rport) {
+  ++rxDdp;
+  if (!looksLikeDdp(p, len)) return;
+  if (!gPSK.isEmpty()) return;               // DDP can't carry the key; stay closed
+
+  const uint8_t flags = p[0];
+  const uint8_t seq   = p[1] & 0x0F;
+  const uint8_t id    = p[3];
+  const int     hdr   = (flags & DDP_F_TIME) ? 14 : 10;
+  if (len < hdr) return;
+
+  if (flags & DDP_F_QUERY) {
+    if (id == DDP_ID_STATUS) ddpReplyStatus(sock, rip, rport, seq);
+    return;
+  }
+
+  if (seq) {
+    if (seq == ddpLastSeq) return;           // duplicate
+    if (ddpLastSeq && seq != (ddpLastSeq % 15) + 1) ++ddpSeqGaps;
+    ddpLastSeq = seq;
+  }
+
+  uint8_t target;
+  if (id == 1 || id == 255)   target = 0;
+  else if (id >= 2 && id <= 5) target = id - 1;
+  else return;
+
+  const uint32_t off  = ((uint32_t)p[4] << 24) | ((uint32_t)p[5] << 16) | ((uint32_t)p[6] << 8) | p[7];
+  uint32_t       dlen = ((uint32_t)p[8] << 8) | p[9];
+  if (dlen > (uint32_t)(len - hdr)) dlen = (uint32_t)(len - hdr);
+
+  RGBCtrl::streamWrite(target, off, p + hdr, dlen, (flags & DDP_F_PUSH) != 0);
+}
+
+uint32_t ddpGaps() { return ddpSeqGaps; }
+
+// ---------- Multi-unit sync (binary beacons on the control port) ----------
+// The leader broadcasts a SyncBeacon every RGBUDP_SYNC_BEACON_MS; followers
+// steer RGBCtrl's show clock to it and take its playlist step. Lowest
+// (prio, id) leads: the PC app beacons with prio 0, a unit set to "leader"
+// uses 1, "auto" units 2 and the one with the lowest MAC-derived id wins.
+// Like DDP, beacons carry no key and are ignored when a PSK is set.
+enum : uint8_t { SYNC_OFF = 0, SYNC_AUTO, SYNC_LEADER, SYNC_FOLLOW, SYNC_MODES };
+static const char* const SYNC_NAMES[SYNC_MODES] = { "off", "auto", "leader", "follow" };
+
+struct __attribute__((packed)) SyncBeacon {
+  char     magic[4];   // "RGBS"
+  uint8_t  ver;        // SYNC_VER
+  uint8_t  prio;       // lower wins
+  uint8_t  flags;      // SYNCF_*
+  uint8_t  idx;        // playlist step (SYNCF_PLAYLIST)
+  uint32_t id;         // sender id; ties on prio go to the lower id
+  int64_t  showUs;     // sender's show clock at send time
+  uint32_t seqCrc;     // playlist table crc (SYNCF_PLAYLIST)
+  uint32_t stepMs;     // time into the current step (SYNCF_PLAYLIST)
+};
+static const uint8_t SYNC_VER       = 1;
+static const uint8_t SYNCF_PLAYLIST = 0x01;
+static const uint8_t SYNC_PRIO_NONE = 0xFF;
+
+static uint8_t  syncMode       = SYNC_OFF;
+static bool     syncLeader     = false;
+static bool     syncLocked     = false;    // follower has a clock estimate
+static uint32_t syncId         = 0;
+static uint32_t syncLeaderId   = 0;
+static uint8_t  syncLeaderPrio = SYNC_PRIO_NONE;
+static uint32_t syncLastRxMs   = 0, syncLastTxMs = 0;
+static uint32_t syncRx = 0, syncTx = 0;
+static int32_t  syncLastErrUs  = 0;
+
+static inline uint8_t syncPrio() { return (syncMode == SYNC_LEADER) ? 1 : 2; }
+static inline bool syncOutranks(uint8_t pa, uint32_t ia, uint8_t pb, uint32_t ib) {
+  return (pa != pb) ? (pa < pb) : (ia < ib);
+}
+static inline bool looksLikeSync(const uint8_t* p, int len) {
+  return len >= (int)sizeof(SyncBeacon) && !memcmp(p, "RGBS", 4);
+}
+
+static void setSyncMode(uint8_t m, bool persist) {
+  if (m >= SYNC_MODES) m = SYNC_OFF;
+  syncMode       = m;
+  syncLeader     = (m == SYNC_LEADER);
+  syncLocked     = false;
+  syncLeaderPrio = SYNC_PRIO_NONE;
+  syncLastRxMs   = millis();                 // listen a full timeout before claiming
+  syncLastTxMs   = syncLastRxMs - RGBUDP_SYNC_BEACON_MS;
+  RGBCtrl::syncEnable(m != SYNC_OFF);
+  if (persist) {
+    Preferences p;
+    p.begin("rgbudp", false);
+    if (p.getUChar("sync", 0xFF) != m) p.putUChar("sync", m);
+    p.end();
+  }
+}
+
+static void sendSyncBeacon() {
+  SyncBeacon b;
+  memset(&b, 0, sizeof(b));
+  memcpy(b.magic, "RGBS", 4);
+  b.ver  = SYNC_VER;
+  b.prio = syncPrio();
+  b.id   = syncId;
+  uint32_t crc, stepMs; uint8_t idx;
+  if (RGBCtrl::syncPlaylistState(crc, idx, stepMs)) {
+    b.flags |= SYNCF_PLAYLIST;
+    b.seqCrc = crc; b.idx = idx; b.stepMs = stepMs;
+  }
+  udp.beginPacket(IPAddress(255,255,255,255), gPort);
+  b.showUs = RGBCtrl::syncClockUs();         // sample as late as possible
+  udp.write((const uint8_t*)&b, sizeof(b));
+  udp.endPacket();
+  ++syncTx;
+}
+
+// rxUs: local esp_timer when the packet was picked up.
+static void handleSyncBeacon(const uint8_t* p, int64_t rxUs) {
+  if (syncMode == SYNC_OFF || !gPSK.isEmpty()) return;
+  SyncBeacon b;
+  memcpy(&b, p, sizeof(b));
+  if (b.ver != SYNC_VER || b.id == syncId) return;
+  ++syncRx;
+
+  if (syncLeader) {
+    if (!syncOutranks(b.prio, b.id, syncPrio(), syncId)) return;  // they'll yield to us
+    syncLeader = false;                                            // better leader: follow
+  }
+  const uint32_t now = millis();
+  if (b.id != syncLeaderId || syncLeaderPrio == SYNC_PRIO_NONE) {
+    const bool stale = (syncLeaderPrio == SYNC_PRIO_NONE) ||
+                       (now - syncLastRxMs > RGBUDP_SYNC_TIMEOUT_MS);
+    if (!stale && !syncOutranks(b.prio, b.id, syncLeaderPrio, syncLeaderId)) return;
+    syncLeaderId = b.id; syncLeaderPrio = b.prio;
+    syncLocked = false;
+  }
+  syncLastRxMs = now;
+
+  // offset = leader show clock - our clock. Transit/poll delay only ever
+  // makes a sample too small, so rises are taken whole and drops (drift)
+  // are eased in.
+  const int64_t est = b.showUs - rxUs;
+  const int64_t cur = RGBCtrl::syncClockOffsetUs();
+  const int64_t err = est - cur;
+  if (!syncLocked || err > 50000 || err < -50000) { RGBCtrl::syncAdjustClock(est); syncLocked = true; }
+  else RGBCtrl::syncAdjustClock(cur + (err > 0 ? err : err / 8));
+  syncLastErrUs = (int32_t)err;
+
+  if (b.flags & SYNCF_PLAYLIST) RGBCtrl::syncPlaylistTo(b.seqCrc, b.idx, b.stepMs);
+}
+
+// Election + beacon timer; called from loop().
+static void serviceSync(bool wifiUp) {
+  if (syncMode == SYNC_OFF) return;
+  const uint32_t now = millis();
+  if (!syncLeader && syncMode != SYNC_FOLLOW) {
+    // Stagger take-over by id so silent-leader elections rarely collide.
+    const uint32_t wait = RGBUDP_SYNC_TIMEOUT_MS + (syncId & 511);
+    if (now - syncLastRxMs > wait) {
+      syncLeader = true;
+      syncLeaderPrio = SYNC_PRIO_NONE;
+      syncLastTxMs = now - RGBUDP_SYNC_BEACON_MS;
+    }
+  }
+  if (syncLeader && wifiUp && now - syncLastTxMs >= RGBUDP_SYNC_BEACON_MS) {
+    sendSyncBeacon();
+    syncLastTxMs = now;
+  }
+}
+
+void statsJson(JsonObject o) {
+  o["json"]    = rxJson;
+  o["badJson"] = rxBadJson;
+  o["plain"]   = rxPlain;
+  o["ddp"]     = rxDdp;
+  o["ddpGaps"] = ddpSeqGaps;
+  JsonObject q = o.createNestedObject("queue");
+  q["deferred"]  = pendQueued;
+  q["coalesced"] = pendCoalesced;
+  q["dropped"]   = pendDropped;
+  q["early"]     = pendEarly;
+  q["depth"]     = pendDepth;
+  q["peak"]      = pendPeak;
+  RGBstats::put(o.createNestedObject("pending"), statPending);
+  JsonObject sy = o.createNestedObject("sync");
+  sy["mode"]   = SYNC_NAMES[syncMode];
+  sy["leader"] = syncLeader;
+  sy["rx"]     = syncRx;
+  sy["tx"]     = syncTx;
+  sy["errUs"]  = syncLastErrUs;
+}
+
+static PendPkt* pendOldest() {
+  PendPkt* best = nullptr;
+  for (uint8_t i=0; i<RGBUDP_PEND_SLOTS; ++i) {
+    PendPkt& q = pendQ[i];
+    if (q.used && (!best || (int32_t)(q.seq - best->seq) < 0)) best = &q;
+  }
+  return best;
+}
+
+// Time-boxed processor for pending heavy ops. Deferred packets are drained
+// oldest-first while the budget lasts (at least one per call), then the
+// queued reset/counts/config work runs.
+static void processPendingWork(uint32_t t0, uint32_t budget_us);
+
 void processPending(uint32_t budget_us) {
+  const bool raw = pendDepth && !quietActive();
+  if (!raw && !pendDoReset && !pendHasCounts && !pendHasCfg) return;   // idle: not a sample
   const uint32_t t0 = micros();
+  processPendingWork(t0, budget_us);
+  statPending.note(micros() - t0);
+}
+
+static void processPendingWork(uint32_t t0, uint32_t budget_us) {
 
-  // 1) If a raw packet was deferred (e.g., SMBus quiet), handle it now.
-  if (pendHasRaw && !quietActive()) {
-    pendHasRaw = false;
-    handleJsonPacket(pendRawBuf, (int)pendRawLen, pendRawIp, pendRawPort);
-    return; // process one heavy item per loop
+  // 1) Packets deferred during an SMBus quiet window.
+  while (pendDepth && !quietActive()) {
+    PendPkt* q = pendOldest();
+    if (!q) { pendDepth = 0; break; }
+    q->used = false; --pendDepth;
+    handleJsonPacket(q->data, (int)q->len, q->ip, q->port);
+    if (micros() - t0 >= budget_us) return;
   }
 
   // 2) Reset
@@ -81,17 +400,10 @@ void processPending(uint32_t budget_us) {
     if (micros() - t0 >= budget_us) return;
   }
 
-  // 4) Config (coalesced to latest)
+  // 4) Config (already parsed and merged at RX time; just commit)
   if (pendHasCfg) {
-    String js = pendJson;      // local copy
-    bool doSave = pendIsSave;
     pendHasCfg = false;
-
-    if (doSave) {
-      RGBCtrl::applyJsonSave(js);
-    } else {
-      RGBCtrl::applyJsonPreview(js);
-    }
+    RGBCtrl::commitStaged();
     (void)budget_us;
   }
 }
@@ -103,21 +415,117 @@ static String macStr() {
   return String(s);
 }
 
-static void reply(IPAddress ip, uint16_t port, const String& json) {
+static void reply(IPAddress ip, uint16_t port, const char* data, size_t len) {
   udp.beginPacket(ip, port);
-  udp.write((const uint8_t*)json.c_str(), json.length());
+  udp.write((const uint8_t*)data, len);
   udp.endPacket();
 }
+static void reply(IPAddress ip, uint16_t port, const String& json) {
+  reply(ip, port, json.c_str(), json.length());
+}
 
+// Acks for the hot ops (preview/save) are formatted on the stack; only a
+// reply that carries the config JSON goes through String.
 static void replyOk(IPAddress ip, uint16_t port, const char* op, const String* cfg = nullptr) {
-  String out = String("{\"ok\":true,\"op\":\"") + op + "\"";
-  if (cfg) { out += ",\"cfg\":"; out += *cfg; }
-  out += "}";
-  reply(ip, port, out);
+  if (cfg) {
+    String out = String("{\"ok\":true,\"op\":\"") + op + "\",\"cfg\":";
+    out += *cfg;
+    out += "}";
+    reply(ip, port, out);
+    return;
+  }
+  char out[64];
+  int n = snprintf(out, sizeof(out), "{\"ok\":true,\"op\":\"%s\"}", op);
+  if (n > 0) reply(ip, port, out, (size_t)n < sizeof(out) ? (size_t)n : sizeof(out) - 1);
 }
 static void replyErr(IPAddress ip, uint16_t port, const char* op, const char* err) {
-  String out = String("{\"ok\":false,\"op\":\"") + op + "\",\"err\":\"" + err + "\"}";
-  reply(ip, port, out);
+  char out[96];
+  int n = snprintf(out, sizeof(out), "{\"ok\":false,\"op\":\"%s\",\"err\":\"%s\"}", op, err);
+  if (n > 0) reply(ip, port, out, (size_t)n < sizeof(out) ? (size_t)n : sizeof(out) - 1);
+}
+
+// Sent instead of the normal ack when a deferred packet is superseded or
+// refused, so the client learns why (and how congested we are).
+//   {"ok":true,"op":"preview","coalesced":true,"q":{...}}
+//   {"ok":false,"op":"queue","err":"busy","q":{...}}
+static void replyQueue(IPAddress ip, uint16_t port, bool ok, const char* op, const char* detail) {
+  char out[160];
+  int n = snprintf(out, sizeof(out),
+                   "{\"ok\":%s,\"op\":\"%s\",%s,"
+                   "\"q\":{\"depth\":%u,\"peak\":%u,\"coalesced\":%lu,\"dropped\":%lu}}",
+                   ok ? "true" : "false", op, detail, (unsigned)pendDepth, (unsigned)pendPeak,
+                   (unsigned long)pendCoalesced, (unsigned long)pendDropped);
+  if (n > 0) reply(ip, port, out, (size_t)n < sizeof(out) ? (size_t)n : sizeof(out) - 1);
+}
+
+// Cheap look at the "op" value without a JSON parse (quiet window!).
+// Only needs to tell previews apart; anything unclear is treated as
+// must-keep.
+static bool isPreviewPacket(const char* p) {
+  const char* k = strstr(p, "\"op\"");
+  if (!k) return false;
+  k += 4;
+  while (*k == ' ' || *k == '\t') ++k;
+  if (*k++ != ':') return false;
+  while (*k == ' ' || *k == '\t') ++k;
+  return !strncmp(k, "\"preview\"", 9);
+}
+
+static void deferPacket(const char* data, size_t len, IPAddress ip, uint16_t port) {
+  const bool preview = isPreviewPacket(data);
+  PendPkt* slot = nullptr;
+
+  if (preview) {
+    for (uint8_t i=0; i<RGBUDP_PEND_SLOTS; ++i)
+      if (pendQ[i].used && pendQ[i].preview) { slot = &pendQ[i]; break; }
+    if (slot) {
+      ++pendCoalesced;
+      replyQueue(slot->ip, slot->port, true, "preview", "\"coalesced\":true");
+      slot->used = false; --pendDepth;
+    }
+  }
+  if (!slot) {
+    for (uint8_t i=0; i<RGBUDP_PEND_SLOTS; ++i)
+      if (!pendQ[i].used) { slot = &pendQ[i]; break; }
+  }
+  if (!slot && !preview) {
+    // Full: a must-keep packet may push out the (single) queued preview.
+    for (uint8_t i=0; i<RGBUDP_PEND_SLOTS; ++i)
+      if (pendQ[i].used && pendQ[i].preview) { slot = &pendQ[i]; break; }
+    if (slot) {
+      ++pendDropped;
+      replyQueue(slot->ip, slot->port, false, "queue", "\"err\":\"busy\"");
+      slot->used = false; --pendDepth;
+    }
+  }
+  if (!slot && !preview) {
+    // Full of must-keep packets: never refuse another one. Handle the
+    // oldest now, inside the quiet window, and queue this one behind it
+    // so they still run in arrival order.
+    slot = pendOldest();
+    if (slot) {
+      ++pendEarly;
+      slot->used = false; --pendDepth;
+      handleJsonPacket(slot->data, (int)slot->len, slot->ip, slot->port);
+    }
+  }
+  if (!slot) {
+    ++pendDropped;                            // a preview; the next one replaces it anyway
+    replyQueue(ip, port, false, "queue", "\"err\":\"busy\"");
+    return;
+  }
+
+  const size_t n = (len < sizeof(slot->data)) ? len : sizeof(slot->data) - 1;
+  memcpy(slot->data, data, n);
+  slot->data[n] = '\0';
+  slot->len     = n;
+  slot->ip      = ip;
+  slot->port    = port;
+  slot->preview = preview;
+  slot->seq     = pendSeq++;
+  slot->used    = true;
+  ++pendQueued;
+  if (++pendDepth > pendPeak) pendPeak = pendDepth;
 }
 
 static String buildDiscoverJson() {
@@ -125,7 +533,8 @@ static String buildDiscoverJson() {
   String out = String("{\"ok\":true,\"op\":\"discover\",\"name\":\"XBOX RGB\",")
              + "\"ver\":\"1.4.x\",\"port\":" + String(gPort)
              + ",\"ip\":\"" + WiFi.localIP().toString() + "\""
-             + ",\"mac\":\"" + macStr() + "\"}";
+             + ",\"mac\":\"" + macStr() + "\""
+             + ",\"sync\":\"" + SYNC_NAMES[syncMode] + "\"}";
   return out;
 }
 
@@ -133,6 +542,19 @@ void begin(uint16_t port, const char* psk) {
   gPort = port;
   gPSK = (psk && *psk) ? String(psk) : String();
   udp.begin(gPort);
+#if RGBUDP_DDP_PORT
+  ddp.begin(RGBUDP_DDP_PORT);
+#endif
+
+  uint8_t m[6]; WiFi.macAddress(m);
+  syncId = ((uint32_t)m[2] << 24) | ((uint32_t)m[3] << 16) | ((uint32_t)m[4] << 8) | m[5];
+  {
+    Preferences p;
+    p.begin("rgbudp", true);
+    const uint8_t sm = p.getUChar("sync", RGBUDP_SYNC_DEFAULT);
+    p.end();
+    setSyncMode(sm, false);
+  }
 
   lastIp = WiFi.localIP();
   // Send an immediate boot advertisement (both formats).
@@ -153,6 +575,7 @@ void sendDiscovery() {
 }
 
 static void handlePlain(IPAddress ip, uint16_t port, const String& s) {
+  ++rxPlain;
   if (s == "RGBDISC?" || s == "RGBDISC?\n") {
     String js = buildDiscoverJson();
     // prefix so plain-text clients can detect easily
@@ -170,10 +593,13 @@ static bool checkKey(JsonVariantConst root) {
 }
 
 // Small helpers to queue work
-static void queuePreviewOrSave(const String& js, bool isSave) {
-  pendJson   = js;
-  pendIsSave = isSave;
-  pendHasCfg = true;  // coalesces to latest
+// The packet is parsed once; its cfg is merged into RGBCtrl's staging copy
+// right away and committed from processPending(). Several packets before a
+// commit accumulate (latest value per field wins).
+static bool queuePreviewOrSave(JsonVariantConst cfg, bool isSave) {
+  if (!RGBCtrl::stageJson(cfg, isSave)) return false;
+  pendHasCfg = true;
+  return true;
 }
 static void queueSetCounts(uint16_t c0, uint16_t c1, uint16_t c2, uint16_t c3) {
   pendCounts[0] = c0; pendCounts[1] = c1; pendCounts[2] = c2; pendCounts[3] = c3;
@@ -184,7 +610,8 @@ static void queueSetCounts(uint16_t c0, uint16_t c1, uint16_t c2, uint16_t c3) {
 static void handleJsonPacket(const char* data, int len, IPAddress rip, uint16_t rport) {
   StaticJsonDocument<1536> doc;
   DeserializationError jerr = deserializeJson(doc, data, len);
-  if (jerr) { replyErr(rip, rport, "parse", "bad json"); return; }
+  ++rxJson;
+  if (jerr) { ++rxBadJson; replyErr(rip, rport, "parse", "bad json"); return; }
 
   if (!checkKey(doc)) { replyErr(rip, rport, "auth", "bad key"); return; }
 
@@ -196,28 +623,113 @@ static void handleJsonPacket(const char* data, int len, IPAddress rip, uint16_t
     reply(rip, rport, js);
   }
   else if (!strcmp(op, "get")) {
-    String cfg = RGBCtrl::getConfigJson();
+    // {"op":"get","since":<gen>} answers {"unchanged":true} if nothing moved on
+    const uint32_t since = doc["since"] | 0u;
+    if (since && since == RGBCtrl::configGen()) {
+      char out[80];
+      int n = snprintf(out, sizeof(out), "{\"ok\":true,\"op\":\"get\",\"gen\":%lu,\"unchanged\":true}",
+                       (unsigned long)since);
+      if (n > 0) reply(rip, rport, out, (size_t)n < sizeof(out) ? (size_t)n : sizeof(out) - 1);
+      return;
+    }
+    uint32_t gen;
+    String cfg = RGBCtrl::getConfigJson(gen);
+    char q[112];
+    snprintf(q, sizeof(q), ",\"gen\":%lu,\"q\":{\"depth\":%u,\"peak\":%u,\"coalesced\":%lu,\"dropped\":%lu}",
+             (unsigned long)gen, (unsigned)pendDepth, (unsigned)pendPeak,
+             (unsigned long)pendCoalesced, (unsigned long)pendDropped);
+    cfg += q;                  // lands after "cfg":{...}, before the closing brace
     replyOk(rip, rport, "get", &cfg);
   }
-  else if (!strcmp(op, "preview")) {
-    // Normalize to cfg JSON and queue (reply OK immediately; apply later)
-    String js;
-    if (doc.containsKey("cfg")) serializeJson(doc["cfg"], js);
-    else serializeJson(doc, js);
-    queuePreviewOrSave(js, /*isSave=*/false);
-    replyOk(rip, rport, "preview");
-  }
-  else if (!strcmp(op, "save")) {
-    String js;
-    if (doc.containsKey("cfg")) serializeJson(doc["cfg"], js);
-    else serializeJson(doc, js);
-    queuePreviewOrSave(js, /*isSave=*/true);
-    replyOk(rip, rport, "save");
+  else if (!strcmp(op, "patch")) {
+    // {"op":"patch","gen":<last seen>,"cfg":{changed fields},"save":false}
+    // Staged like preview (never coalesced: each patch carries different
+    // fields). A stale gen is refused so the client can re-get first.
+    JsonVariantConst cfg = doc["cfg"];
+    if (!cfg.is<JsonObjectConst>()) { replyErr(rip, rport, op, "cfg must be an object"); return; }
+    uint32_t gen = 0;
+    const bool ok = RGBCtrl::stagePatch(cfg, doc["gen"] | 0u, doc["save"] | false, gen);
+    if (ok) pendHasCfg = true;
+    char out[96];
+    int n = snprintf(out, sizeof(out), ok ? "{\"ok\":true,\"op\":\"patch\",\"gen\":%lu}"
+                                          : "{\"ok\":false,\"op\":\"patch\",\"err\":\"stale\",\"gen\":%lu}",
+                     (unsigned long)gen);
+    if (n > 0) reply(rip, rport, out, (size_t)n < sizeof(out) ? (size_t)n : sizeof(out) - 1);
+  }
+  else if (!strcmp(op, "preview") || !strcmp(op, "save")) {
+    // Stage straight from this document (reply OK immediately; apply later)
+    const bool isSave = !strcmp(op, "save");
+    JsonVariantConst cfg = doc.as<JsonVariantConst>();
+    if (cfg.containsKey("cfg")) cfg = cfg["cfg"];
+    if (!queuePreviewOrSave(cfg, isSave)) { replyErr(rip, rport, op, "cfg must be an object"); return; }
+    replyOk(rip, rport, op);
   }
   else if (!strcmp(op, "reset")) {
     pendDoReset = true;        // queue to avoid doing it in RX path
     replyOk(rip, rport, "reset");
   }
+  else if (!strcmp(op, "stats")) {
+    // {"op":"stats","section":"render"}: the whole document is several KB,
+    // more than one datagram holds, so it is fetched one section at a time.
+    // No section gives the summary plus the list of sections to ask for.
+    const char* sec = doc["section"] | "summary";
+    String out = String("{\"ok\":true,\"op\":\"stats\",\"section\":\"") + sec + "\",\"stats\":";
+    if (!strcmp(sec, "wifi")) {
+      out += "{\"wifi\":";
+      out += WiFiMgr::profileJson();
+      out += "}";
+    } else {
+      String st = RGBCtrl::getStatsJson(sec);
+      if (st.isEmpty()) { replyErr(rip, rport, op, "unknown section"); return; }
+      out += st;
+    }
+    if (!strcmp(sec, "summary"))
+      out += ",\"sections\":[\"render\",\"modes\",\"udp\",\"smbus\",\"sys\",\"wifi\"]";
+    out += "}";
+    if (out.length() > RGBUDP_MAX_REPLY) { replyErr(rip, rport, op, "too big"); return; }
+    reply(rip, rport, out);
+  }
+  else if (!strcmp(op, "ota")) {
+    // progress/throughput of the current (or last) HTTP OTA upload
+    String out = "{\"ok\":true,\"op\":\"ota\",\"status\":";
+    out += WiFiMgr::otaStatusJson();
+    out += "}";
+    reply(rip, rport, out);
+  }
+  else if (!strcmp(op, "bench")) {
+    // {"op":"bench","run":true,"frames":64} starts; {"op":"bench"} polls.
+    // A full result is ~2 KB, so it is left to GET /config/api/bench and
+    // the poll only says it is done.
+    if ((doc["run"] | false) && !RGBCtrl::benchStart(doc["frames"] | 64)) {
+      replyErr(rip, rport, "bench", "busy"); return;
+    }
+    String out = "{\"ok\":true,\"op\":\"bench\",\"status\":";
+    out += RGBCtrl::benchStatusJson();
+    out += "}";
+    if (out.length() > RGBUDP_MAX_REPLY) out = "{\"ok\":true,\"op\":\"bench\",\"status\":{\"state\":\"done\"}}";
+    reply(rip, rport, out);
+  }
+  else if (!strcmp(op, "sync")) {
+    // {"op":"sync"} queries; {"op":"sync","mode":"auto"} also sets (persisted)
+    const char* mode = doc["mode"] | "";
+    if (*mode) {
+      uint8_t k = 0;
+      while (k < SYNC_MODES && strcmp(mode, SYNC_NAMES[k])) ++k;
+      if (k >= SYNC_MODES) { replyErr(rip, rport, "sync", "bad mode"); return; }
+      setSyncMode(k, true);
+    }
+    char out[224];
+    int n = snprintf(out, sizeof(out),
+                     "{\"ok\":true,\"op\":\"sync\",\"mode\":\"%s\",\"id\":%lu,\"leader\":%s,"
+                     "\"leaderId\":%lu,\"locked\":%s,\"offsetUs\":%lld,\"errUs\":%ld,"
+                     "\"rx\":%lu,\"tx\":%lu}",
+                     SYNC_NAMES[syncMode], (unsigned long)syncId, syncLeader ? "true" : "false",
+                     (unsigned long)(syncLeader ? syncId : syncLeaderId),
+                     syncLocked ? "true" : "false",
+                     (long long)RGBCtrl::syncClockOffsetUs(), (long)syncLastErrUs,
+                     (unsigned long)syncRx, (unsigned long)syncTx);
+    if (n > 0) reply(rip, rport, out, (size_t)n < sizeof(out) ? (size_t)n : sizeof(out) - 1);
+  }
   else if (!strcmp(op, "setCounts")) {
     auto arr = doc["c"];
     if (!arr || arr.size() < 4) { replyErr(rip, rport, "setCounts", "need 4 ints"); return; }
@@ -250,9 +762,21 @@ void loop() {
     }
   }
 
+  serviceSync(wifiUp);
+
   // Always give pending work a small budget each pass to avoid long stalls.
   processPending(1500);
 
+#if RGBUDP_DDP_PORT
+  // --- DDP stream: drain everything queued so frames don't back up ---
+  for (uint8_t n=0; n<8; ++n) {
+    int dl = ddp.parsePacket();
+    if (dl <= 0) break;
+    int rd = ddp.read(ddpBuf, sizeof(ddpBuf));
+    if (rd > 0) handleDdp(ddp, ddpBuf, rd, ddp.remoteIP(), ddp.remotePort());
+  }
+#endif
+
   // --- incoming packets ---
   int pkLen = udp.parsePacket();
   if (pkLen <= 0 || pkLen >= (int)sizeof(buf)) return;
@@ -260,10 +784,23 @@ void loop() {
   IPAddress rip = udp.remoteIP();
   uint16_t rport = udp.remotePort();
 
+  const int64_t rxUs = esp_timer_get_time();   // sync beacons want the pickup time
   int read = udp.read((uint8_t*)buf, pkLen);
   if (read <= 0) return;
   buf[read] = '\0';
 
+  // Sync beacons first: "RGBS" would also pass looksLikeDdp().
+  if (looksLikeSync((const uint8_t*)buf, read)) {
+    handleSyncBeacon((const uint8_t*)buf, rxUs);
+    return;
+  }
+
+  // Binary DDP on the control port (cheap; never deferred).
+  if (isDdpPacket((const uint8_t*)buf, read)) {
+    handleDdp(udp, (const uint8_t*)buf, read, rip, rport);
+    return;
+  }
+
   // Plain-text discovery is always cheap; answer immediately.
   if (buf[0] != '{') {
     handlePlain(rip, rport, String(buf));
@@ -272,14 +809,7 @@ void loop() {
 
   // If SMBus has requested a quiet window, defer the whole JSON packet.
   if (quietActive()) {
-    // Keep only ONE raw packet; overwrite older if new arrives (coalescing).
-    size_t toCopy = (read < (int)sizeof(pendRawBuf)) ? (size_t)read : (sizeof(pendRawBuf)-1);
-    memcpy(pendRawBuf, buf, toCopy);
-    pendRawBuf[toCopy] = '\0';
-    pendRawLen  = toCopy;
-    pendRawIp   = rip;
-    pendRawPort = rport;
-    pendHasRaw  = true;
+    deferPacket(buf, (size_t)read, rip, rport);
     return;
   }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include <Arduino.h>
+#include <ArduinoJson.h>
 
 namespace RGBCtrlUDP {
 
@@ -20,4 +21,10 @@ void processPending(uint32_t budget_us = 1500);
 // Ask UDP code to avoid heavy JSON work for at least `dur_us` microseconds.
 void enterSmbusQuietUs(uint32_t dur_us);
 
+// DDP stream: count of sequence-number gaps seen (lost/reordered packets).
+uint32_t ddpGaps();
+
+// Packet/queue counters and processPending() time, for RGBCtrl's /api/stats.
+void statsJson(JsonObject o);
+
 } // namespace RGBCtrlUDP
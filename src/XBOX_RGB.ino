@@ -3,15 +3,23 @@
 #include "RGBCtrl.h"
 #include "RGBsmbus.h"
 #include "RGBudp.h"
+#include "RGBstats.h"
 #include  <ESPmDNS.h>
+#include <atomic>
 
 extern AsyncWebServer server;
 
-void setup() {
-  LedStat::begin();
+// Network bring-up (portal, STA connect, web routes, SMBus + UDP listeners)
+// runs on its own task so the ring lights as soon as RGBCtrl has its saved
+// config; loop() leaves those modules alone until it is done. The release
+// store / acquire load make netBoot's setup visible to loop() on the other core.
+static std::atomic<bool> netUp{false};
+
+static void netStart() {
   WiFiMgr::begin();
-  RGBCtrl::begin({ /*ch1=*/2, /*ch2=*/3, /*ch3=*/4, /*ch4=*/5 });
+  RGBstats::bootMark(RGBstats::BOOT_WIFI);
   RGBCtrl::attachWeb("/config");
+  RGBstats::bootMark(RGBstats::BOOT_WEB);
   RGBsmbus::begin({
     /*ch5=*/6,   // CPU bar
     /*ch6=*/7,   // Fan bar
@@ -19,13 +27,29 @@ void setup() {
     /*scl=*/9     // XSCL
   }, 10, 10);
   RGBCtrlUDP::begin(7777 /*port*/, nullptr /*or "my_psk"*/);
+  RGBstats::bootMark(RGBstats::BOOT_UDP);
+  netUp.store(true, std::memory_order_release);
+}
+
+static void netBoot(void*) {
+  netStart();
+  vTaskDelete(nullptr);
+}
+
+void setup() {
+  RGBstats::bootMark(RGBstats::BOOT_SETUP);
+  RGBCtrl::begin({ /*ch1=*/2, /*ch2=*/3, /*ch3=*/4, /*ch4=*/5 });
+  LedStat::begin();
+  if (xTaskCreatePinnedToCore(netBoot, "netBoot", 8192, nullptr, 1, nullptr, 1) != pdPASS)
+    netStart();         // no task: the old blocking order
 }
 
 
 void loop() {
   LedStat::loop();
-  WiFiMgr::loop();
   RGBCtrl::loop();
+  if (!netUp.load(std::memory_order_acquire)) return;   // network still booting; ring runs regardless
+  WiFiMgr::loop();
   RGBsmbus::loop();
   RGBCtrlUDP::loop();
 
@@ -35,6 +59,7 @@ void loop() {
     if (connected && !mdnsStarted) {
         if (MDNS.begin("xboxrgb")) {
             Serial.println("[mDNS] Started: http://xboxrgb.local/");
+            RGBstats::bootMark(RGBstats::BOOT_MDNS);
             mdnsStarted = true;
         } else {
             Serial.println("[mDNS] mDNS start failed");
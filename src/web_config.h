@@ -0,0 +1,486 @@
+// Generated by tools/webgz.py from web/config.html -- do not edit by hand.
+#pragma once
+#include <Arduino.h>
+
+// 25334 bytes raw, 7631 gzip'd
+static const char    CONFIG_HTML_ETAG[]  = "224d30c5";
+static const size_t  CONFIG_HTML_GZ_LEN  = 7631;
+static const uint8_t CONFIG_HTML_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x3d,0xdb,0x72,0xdb,0x48,
+  0x76,0xef,0xfa,0x8a,0x36,0xbd,0x19,0x82,0x23,0xf0,0x2e,0xcb,0x32,0x28,0xd2,0xb1,
+  0x28,0x7b,0xc6,0x1b,0x7b,0xec,0xb2,0xec,0x9d,0x4d,0x14,0xd5,0x0e,0x08,0x34,0x49,
+  0x58,0x20,0xc0,0x01,0x40,0x51,0x1a,0x0d,0xab,0xe6,0x29,0xef,0xa9,0xcd,0x17,0xe4,
+  0x21,0x55,0xf9,0x8d,0x7c,0xca,0x7c,0x49,0xce,0x39,0xdd,0x0d,0x34,0x40,0xf0,0xe2,
+  0xcb,0x56,0xf6,0x21,0xae,0x1a,0x9b,0xec,0x3e,0x7d,0xfa,0xf4,0xe9,0x73,0xef,0x6e,
+  0xce,0xe9,0x03,0x37,0x74,0x92,0xbb,0x39,0x67,0xd3,0x64,0xe6,0x0f,0x4e,0xe5,0xdf,
+  0xdc,0x76,0x07,0x07,0xa7,0x33,0x9e,0xd8,0xcc,0x99,0xda,0x51,0xcc,0x93,0x7e,0x65,
+  0x91,0x8c,0xeb,0x27,0x95,0xe6,0x40,0x34,0x07,0xf6,0x8c,0xf7,0x2b,0x37,0x1e,0x5f,
+  0xce,0xc3,0x28,0xa9,0x30,0x27,0x0c,0x12,0x1e,0x00,0xd8,0xd2,0x73,0x93,0x69,0xdf,
+  0xe5,0x37,0x9e,0xc3,0xeb,0xf4,0xc5,0xf4,0x02,0x2f,0xf1,0x6c,0xbf,0x1e,0x3b,0xb6,
+  0xcf,0xfb,0x6d,0xc0,0x71,0x70,0x9a,0x78,0x89,0xcf,0x07,0xef,0xbe,0x3b,0x63,0x43,
+  0x18,0x19,0x85,0xbe,0xcf,0xa3,0xd3,0xa6,0x68,0x3d,0x38,0x8d,0x93,0x3b,0xfc,0xd7,
+  0x8a,0xc2,0x30,0xb9,0xaf,0xd7,0x47,0x13,0xeb,0x61,0x6b,0xdc,0x6e,0xb7,0x1f,0xf5,
+  0xea,0x75,0xc7,0x8e,0x5c,0xeb,0x61,0xfb,0xb8,0x6d,0x77,0x3a,0xf0,0xd5,0xb6,0x1e,
+  0x1e,0xdb,0xf6,0x93,0xf1,0x18,0x3e,0x27,0xd6,0x43,0xf7,0x98,0xb7,0xe9,0xf3,0x6c,
+  0x91,0x70,0x80,0x7b,0x72,0x64,0x77,0x47,0x27,0xbd,0xd5,0xc1,0xb7,0xf7,0xa3,0xf0,
+  0xb6,0x1e,0x7b,0xbf,0x78,0xc1,0xc4,0x1a,0x85,0x91,0xcb,0xa3,0x3a,0xb4,0xac,0x46,
+  0xa1,0x7b,0x77,0x3f,0xb3,0xa3,0x89,0x17,0x58,0xad,0xde,0xc8,0x76,0xae,0x27,0x51,
+  0xb8,0x08,0x5c,0xeb,0xc6,0x8e,0x0c,0x9c,0xba,0xd6,0x73,0x42,0x3f,0x8c,0xe4,0xf7,
+  0xa4,0xd6,0x1b,0x03,0xc1,0xf5,0xb1,0x3d,0xf3,0xfc,0x3b,0xeb,0x25,0xac,0x3a,0x32,
+  0xe3,0xbb,0x38,0xe1,0xb3,0xfa,0xc2,0x33,0x2f,0xf8,0x24,0xe4,0xec,0xc3,0x4b,0xf3,
+  0x5d,0x38,0x0a,0x93,0xd0,0x7c,0x16,0xc1,0xc2,0x57,0x07,0x0d,0x64,0x8f,0xed,0x05,
+  0x3c,0x82,0xa9,0x6e,0x05,0x5b,0xac,0x27,0x27,0xad,0xf9,0x6d,0x4f,0x4e,0xdd,0x39,
+  0x9a,0xdf,0x32,0x7b,0x91,0x84,0xbd,0xb9,0xed,0xba,0x48,0x63,0x8b,0xb5,0x8f,0xe7,
+  0xb7,0x38,0x16,0x16,0x7c,0xbf,0x46,0x18,0xb6,0xd6,0x7a,0x72,0x21,0x91,0xed,0x7a,
+  0x8b,0xd8,0xc2,0x01,0xe9,0xf8,0xf6,0x09,0x60,0xa4,0x16,0x5a,0xf8,0xd4,0x76,0xc3,
+  0x25,0x20,0x85,0x06,0x46,0x93,0x3d,0x6c,0xb5,0x5a,0x27,0x72,0x7a,0xe0,0x44,0x92,
+  0x84,0x33,0x1a,0x03,0x33,0x46,0xe1,0xf2,0xde,0xf5,0xe2,0xb9,0x6f,0xdf,0x59,0x93,
+  0xc8,0x73,0x7b,0xf8,0x57,0x1d,0x96,0x08,0x2d,0x09,0xaf,0x03,0x3f,0x16,0xb3,0x20,
+  0xb6,0x22,0x3e,0xe7,0x76,0x62,0xb4,0x3b,0x66,0x7b,0x1c,0xd5,0x7a,0x13,0x7b,0x6e,
+  0xb5,0x3b,0x84,0x60,0x7a,0x4f,0x4c,0x02,0x6e,0x73,0xab,0xd3,0xc9,0x56,0xd9,0x62,
+  0xb0,0x2a,0x04,0xf1,0xed,0x11,0xf7,0x35,0xa0,0x76,0x17,0x80,0x74,0x3e,0xd3,0xf6,
+  0xd5,0x7a,0x8a,0x8a,0x91,0x1f,0x3a,0xd7,0x05,0x62,0x89,0x3b,0x5e,0x30,0x5f,0x24,
+  0x66,0xcc,0x7d,0xee,0x24,0xe6,0x68,0x01,0x1d,0xc1,0xbd,0x60,0x6f,0xbb,0xd5,0xfa,
+  0x87,0x8c,0x19,0x2d,0x64,0x46,0x87,0x98,0x91,0xe3,0x58,0x2b,0x6d,0xb2,0xda,0x00,
+  0x12,0x87,0xbe,0xe7,0xb2,0x87,0x1d,0xbb,0xdb,0x3e,0xea,0xe8,0xd2,0xf0,0xb0,0x35,
+  0x6a,0xf1,0xf6,0x91,0xa4,0x51,0x8a,0x99,0x9c,0xfe,0x12,0x15,0xa8,0x4f,0x3d,0x57,
+  0xf7,0xe9,0xf6,0xf5,0xa6,0xdc,0x9b,0x4c,0x13,0xeb,0x08,0xa6,0x58,0x49,0xca,0x72,
+  0x08,0xc7,0xed,0xc7,0x1d,0xbb,0x64,0xf2,0xee,0xa3,0xa3,0xce,0xa3,0x51,0xcf,0x59,
+  0x44,0x31,0x4c,0x35,0x0f,0x3d,0x94,0xb1,0xd5,0x81,0x40,0xd1,0x98,0x47,0x1e,0xb0,
+  0xe1,0x2e,0x87,0xaa,0xf3,0xe8,0xb8,0xcb,0x47,0x0a,0x55,0x4b,0xec,0xe0,0xc0,0xf5,
+  0x6e,0xee,0x69,0xe3,0xc4,0x7e,0x59,0xf1,0xdc,0x0e,0x80,0x07,0xab,0x7f,0x9c,0x71,
+  0xd7,0xb3,0x8d,0x19,0x70,0x52,0x70,0xea,0x71,0x0b,0x48,0xac,0xdd,0x37,0x66,0x6e,
+  0xfd,0x78,0x7d,0xc4,0xf1,0x0a,0x3b,0x8e,0xd6,0x3b,0x8e,0xa8,0xa3,0xbb,0xde,0xd1,
+  0x5d,0x01,0x05,0x23,0xdb,0x9d,0xf0,0x54,0x8a,0xbc,0xc0,0x07,0xe9,0xaf,0x8b,0x6d,
+  0xcc,0xb3,0xb5,0xdd,0xe9,0xb4,0xca,0xb6,0xe0,0x71,0xf7,0xf8,0xd1,0x63,0xc5,0xef,
+  0x27,0xdc,0x41,0xb5,0x56,0xcc,0x85,0x8d,0x64,0x27,0x6b,0x9b,0xf9,0xe4,0xc9,0x13,
+  0x68,0xd3,0x84,0x2a,0x93,0xbc,0xba,0xcf,0xc7,0x89,0x25,0xa4,0x7b,0x0a,0x0c,0xbd,
+  0x57,0x78,0x5b,0xf6,0x91,0xf3,0xa4,0x30,0x86,0x60,0xdc,0x8c,0xf8,0x20,0x0c,0x38,
+  0xb4,0x25,0xe1,0x64,0xe2,0x67,0xad,0x63,0x9f,0xdf,0xf6,0x6c,0xdf,0x9b,0x04,0x75,
+  0x0f,0x54,0x23,0xb6,0x1c,0x8e,0x1b,0x45,0x6a,0x80,0xb4,0x61,0x7f,0x7d,0x19,0xc1,
+  0x37,0xfc,0x0b,0xc6,0x8f,0xc1,0x98,0x81,0x01,0x28,0x91,0xf2,0x02,0xc9,0x09,0xbf,
+  0x4d,0xea,0x84,0x59,0xe1,0x54,0xeb,0x46,0x95,0x6e,0x91,0xfa,0x02,0xbe,0x98,0xcf,
+  0x53,0xc3,0xc5,0x68,0x69,0x63,0x8f,0xfb,0x2e,0x18,0xeb,0xfb,0x8d,0xec,0x2c,0x48,
+  0x7f,0x47,0xb3,0x17,0x64,0x2e,0x50,0x56,0x0f,0x7c,0x3e,0xe1,0x81,0x9b,0x49,0x32,
+  0xda,0x8c,0xc2,0x46,0xac,0x31,0x4c,0x6c,0x70,0x9e,0x39,0x64,0x10,0x5a,0x65,0xac,
+  0x10,0xd0,0x03,0x61,0x05,0xf6,0x61,0xe8,0xb1,0x66,0x43,0x56,0x07,0xc8,0x20,0x3b,
+  0xe2,0xb6,0xae,0xe9,0x28,0xce,0x52,0xe3,0xda,0x9d,0xd6,0x57,0x56,0xf4,0x75,0x3b,
+  0xb2,0x3a,0x70,0x42,0x10,0x91,0x4f,0x11,0xe5,0x3c,0x41,0xba,0xa9,0x46,0x71,0x26,
+  0x6b,0xd6,0xfc,0x96,0xbd,0x05,0x56,0xf8,0x5e,0x9c,0x30,0x50,0xd2,0x24,0x8c,0xd8,
+  0xb7,0xcd,0x83,0xc6,0x1c,0x1b,0xf2,0x7c,0x22,0x96,0xba,0x5e,0x04,0x66,0xcf,0x0b,
+  0x41,0x4e,0x48,0xfd,0x32,0x8e,0x4b,0xa9,0x4f,0x42,0xf1,0x1d,0xa5,0x25,0x01,0x71,
+  0xd9,0x57,0x2e,0x5a,0xba,0x1f,0x21,0xce,0xad,0xad,0x53,0xa2,0x64,0x0d,0x54,0xff,
+  0xcf,0xf5,0x16,0x19,0x69,0x02,0xcf,0x46,0x9b,0x75,0xb0,0x66,0xb4,0x9e,0x08,0xa3,
+  0x75,0xc0,0x98,0x36,0x9e,0x81,0xa3,0xf5,0xeb,0x9d,0x75,0x14,0x80,0xa1,0x04,0xb0,
+  0xd4,0x76,0x95,0x01,0x96,0x5a,0xbf,0x03,0xb4,0x72,0x49,0x50,0xd7,0xbd,0x65,0x2a,
+  0xf7,0xeb,0x16,0x40,0xdf,0x13,0xe1,0xd8,0x71,0xf0,0x6d,0x9c,0xea,0xd9,0xb1,0x54,
+  0xc0,0xc2,0x66,0x9c,0xec,0x2b,0xb8,0xed,0x56,0xfb,0x04,0x1c,0x4a,0x5e,0x70,0x8b,
+  0x5e,0x44,0x4e,0x6a,0x4d,0xc3,0x1b,0xb0,0x45,0x63,0xcf,0x87,0x56,0x6b,0x14,0xa1,
+  0xde,0x04,0x3c,0x8e,0x8d,0x76,0xa3,0x5d,0x03,0x28,0x32,0x4c,0x3b,0x8c,0xe4,0x69,
+  0x53,0x84,0x69,0xa7,0x4d,0x8a,0x17,0x4f,0x31,0x92,0x1a,0x9c,0xc2,0x0e,0x32,0xc7,
+  0xb7,0xe3,0xb8,0x5f,0x49,0x83,0x9e,0x0a,0x84,0x74,0x7a,0x3b,0x84,0x2e,0xd0,0xc4,
+  0xd8,0xe9,0xb4,0xa3,0xda,0xa6,0x95,0x42,0x30,0xc8,0x8c,0xe1,0xf7,0xed,0xdf,0x7f,
+  0xfb,0xeb,0xf0,0xfb,0xa3,0xda,0x29,0x71,0xdc,0x73,0xfb,0x95,0x38,0xb1,0x93,0x45,
+  0x5c,0x51,0xa3,0xc8,0xc9,0x54,0x06,0x7e,0x68,0x23,0x07,0x7f,0xff,0xed,0xbf,0x80,
+  0x26,0x00,0x45,0x92,0x3a,0x34,0x81,0x36,0x2b,0x6c,0x13,0x4d,0x9a,0x6f,0x45,0xd7,
+  0x56,0x19,0x9c,0x92,0x25,0x1a,0xbc,0x06,0x95,0x3e,0x6d,0x8a,0xcf,0x04,0x09,0xb0,
+  0x22,0xb4,0xa0,0xc9,0x67,0xd0,0x5d,0x51,0x1d,0xd0,0x15,0xce,0x51,0xf7,0xd8,0x8d,
+  0xed,0x2f,0x20,0x16,0x6e,0x55,0x06,0x17,0xb8,0x37,0xa7,0x4d,0xd1,0xbe,0x11,0xb0,
+  0x5d,0x19,0x9c,0x81,0xf1,0x4a,0xa6,0x7c,0x27,0x68,0xa7,0x32,0x18,0xe2,0x1e,0xb0,
+  0x1f,0xbd,0xf9,0x6e,0xe8,0x6e,0x65,0xf0,0x0a,0x82,0xf5,0x30,0xd8,0x09,0x09,0x4b,
+  0x7e,0x07,0x3b,0x33,0x0a,0x97,0x3b,0x41,0x1f,0x55,0x06,0xef,0x61,0x7f,0x41,0x4c,
+  0xd8,0x70,0x6a,0xc7,0xbb,0xa9,0x38,0x86,0x01,0x4b,0x2f,0xb8,0xf6,0x77,0x83,0x3e,
+  0xc6,0xe5,0x41,0x3a,0xb1,0x13,0xf0,0xa4,0x32,0x78,0xcd,0x13,0x1e,0x46,0x3b,0x21,
+  0x9f,0x00,0x4a,0x0c,0x32,0xd8,0xc5,0xdc,0xdb,0xcd,0x87,0x36,0x6c,0x1a,0x18,0xdc,
+  0x78,0x66,0xef,0x06,0x85,0x6d,0x7b,0x01,0xf6,0x96,0x35,0xd9,0x0b,0xdf,0x73,0xae,
+  0xf9,0x6e,0x5a,0xda,0xb0,0x7d,0x6f,0x21,0xe5,0x49,0x12,0xce,0x86,0x77,0xce,0x1e,
+  0x0c,0x69,0x77,0xb5,0x11,0x7b,0x71,0xbb,0x0d,0x5b,0x39,0x5c,0xc4,0x10,0x0f,0x33,
+  0x43,0xb9,0x8e,0xda,0xee,0x51,0xb8,0xab,0x60,0xa0,0xd9,0x3b,0x6e,0x83,0x03,0xb9,
+  0xd9,0x63,0x1e,0xd8,0xd6,0x17,0xa0,0x84,0x9b,0x06,0x80,0xe2,0x91,0xa2,0x48,0x0d,
+  0x6b,0x82,0x8a,0xed,0x50,0xb6,0xb3,0xd4,0xe8,0x28,0x95,0x3b,0xa5,0x68,0x9a,0x54,
+  0x2d,0xb3,0x48,0x15,0x46,0xd1,0x75,0x25,0xb2,0x03,0x50,0x75,0x06,0x0e,0x00,0x35,
+  0x88,0x41,0x1a,0x05,0xea,0xf1,0x08,0xd6,0xb1,0xcf,0x5c,0x17,0x73,0xce,0xdd,0x92,
+  0x69,0x62,0x6c,0x2f,0x9b,0xa1,0xf5,0xa9,0x33,0xbc,0x88,0x20,0x21,0x66,0xef,0x40,
+  0x4f,0x98,0xf1,0xe2,0xed,0x45,0xad,0x64,0xb2,0xf1,0x3c,0x5d,0x4c,0xb0,0x98,0x8d,
+  0xc0,0x2c,0xca,0xd5,0xa8,0xc9,0x20,0x6e,0xd9,0x6f,0xb2,0xf7,0x40,0x6a,0xec,0xd1,
+  0xf6,0x18,0xb3,0xb8,0x6c,0xae,0x24,0x85,0x28,0x9d,0x32,0x9d,0x11,0x72,0x40,0xf8,
+  0x8c,0xee,0x0e,0x34,0x3d,0x9b,0xbd,0x6c,0xfa,0x2e,0x83,0x1d,0xc7,0xff,0xea,0xe8,
+  0x4a,0x10,0xfb,0x5d,0x4a,0xd0,0x4b,0xd5,0x52,0x42,0x4a,0x06,0xfd,0xf9,0x7c,0xce,
+  0xe6,0x26,0xe7,0x9f,0xce,0xfb,0x23,0x7e,0x03,0x8d,0xfc,0xce,0x9e,0x97,0xcc,0x2c,
+  0x60,0xb7,0xc9,0x4f,0x6b,0xbf,0x49,0xc9,0x0f,0x3e,0x4b,0x67,0x7d,0x2b,0x52,0x30,
+  0x46,0xa6,0xb9,0x64,0x5e,0x09,0x2e,0x27,0xa6,0x6f,0x9f,0x30,0xcf,0x59,0x26,0xb5,
+  0x1c,0x3c,0xa8,0xbb,0x73,0xa6,0xb3,0xcf,0x9d,0x69,0x98,0xce,0x24,0x9c,0xcc,0x70,
+  0xd3,0x0c,0xc3,0xcf,0x9d,0xe1,0xbc,0x30,0xc3,0xf9,0xa6,0x19,0xce,0x3f,0x63,0x86,
+  0xb9,0x30,0x94,0xd9,0xb6,0x48,0xc3,0x79,0x01,0x21,0xca,0x16,0x2f,0x2e,0x87,0x0d,
+  0x21,0x68,0x4a,0x2a,0xdb,0x9c,0x74,0x9b,0x39,0x82,0xed,0x3b,0x9d,0x34,0x13,0xe8,
+  0xb9,0x3b,0xe8,0x88,0x31,0xf1,0x3e,0xbe,0xba,0xbb,0x2f,0x2c,0x28,0xfe,0xd1,0x06,
+  0xd8,0x52,0xb3,0x5b,0xca,0xb6,0x6c,0x27,0xbe,0x6f,0x83,0x89,0x8a,0x20,0xd0,0xaa,
+  0x31,0x62,0x42,0xd9,0x9e,0xb4,0xb6,0x9a,0x8d,0x6e,0x6b,0xbb,0xe2,0x68,0x73,0x75,
+  0x98,0xf1,0x0a,0x52,0xef,0x2d,0x53,0xb5,0xbf,0xd6,0x54,0x5d,0x66,0x80,0x77,0x8a,
+  0xb6,0x4c,0xd5,0xf9,0x5a,0x53,0x1d,0xc1,0x54,0xe8,0xa0,0xb6,0xcc,0xd5,0xdd,0x7b,
+  0x2e,0x31,0xd9,0x83,0x7a,0x9d,0xcd,0x21,0xea,0x77,0xa6,0x76,0x10,0x70,0x9f,0x45,
+  0x1c,0x02,0xf4,0x98,0x33,0x51,0x75,0x88,0x59,0xbd,0x5e,0x4a,0x15,0xc6,0x18,0x4a,
+  0x16,0x54,0xfa,0xaf,0x09,0x92,0x48,0xe5,0x07,0x43,0x89,0xf4,0x5c,0x25,0x8c,0x40,
+  0xb1,0xe8,0xc9,0x40,0x35,0xbc,0x22,0x3d,0xd7,0x94,0x03,0x31,0x15,0x57,0x08,0x04,
+  0xa6,0x52,0xe2,0x4c,0xb9,0x73,0x3d,0x0a,0x6f,0x2b,0x03,0x08,0x10,0x04,0xdd,0x9a,
+  0x98,0x15,0x94,0x71,0x23,0xba,0xf6,0x56,0x74,0x4a,0x92,0xf6,0xc5,0xd6,0xd9,0x8a,
+  0x4d,0x09,0xcb,0xbe,0xd8,0xba,0x5b,0xb1,0xa5,0xf2,0xb0,0x86,0x4e,0x93,0x27,0xfc,
+  0x92,0xdf,0xa2,0x35,0x01,0xf8,0xe1,0xf9,0x8f,0x16,0x7b,0x6d,0xc7,0x18,0x6d,0xbf,
+  0x19,0x8f,0xbf,0x6c,0xd3,0x05,0x9e,0xaf,0xb0,0xd3,0x33,0x42,0x04,0xf4,0x94,0xf0,
+  0x40,0x23,0xd6,0x18,0xf9,0x76,0x70,0xcd,0x6c,0xdf,0x67,0x52,0x88,0xe3,0x2f,0xe5,
+  0xc7,0xbf,0x84,0x10,0x02,0x5a,0x39,0xbd,0xe0,0xe3,0x31,0x88,0x70,0xcc,0xc0,0x3c,
+  0x42,0x26,0xcd,0xc2,0x31,0x83,0x44,0x0a,0x94,0xca,0x0b,0x18,0xe6,0x67,0x5f,0xc6,
+  0x32,0x9a,0xaf,0x84,0x63,0x62,0x11,0xd4,0xcb,0x8c,0x3f,0x5e,0xbc,0xf9,0x81,0xd9,
+  0x51,0x64,0xdf,0x99,0xcc,0x9e,0xcf,0x7d,0x8f,0xbb,0x6c,0x39,0xe5,0x01,0xbb,0x0b,
+  0x17,0xcc,0xe7,0xf6,0x0d,0x27,0x92,0x80,0x3f,0x3d,0x06,0x31,0x76,0x72,0xc7,0xfa,
+  0xd0,0x1f,0xfa,0x9c,0x45,0x90,0xa4,0x96,0xb0,0x44,0x95,0xb3,0x88,0xd9,0xbf,0xe0,
+  0x24,0x15,0x06,0xd9,0x6a,0x4c,0x96,0xff,0xb4,0xa9,0xba,0xcb,0x77,0x10,0xab,0x99,
+  0xb9,0xfd,0x7b,0x6e,0x3b,0x53,0x86,0x58,0x98,0x17,0x33,0x9b,0xcd,0x65,0x52,0x50,
+  0xa7,0x64,0x9d,0x42,0x3d,0x68,0x5b,0xc4,0xec,0x14,0x0b,0x58,0x03,0x67,0x7a,0xda,
+  0xa4,0x0f,0x56,0xba,0x69,0xac,0x05,0x69,0x77,0x57,0xcf,0xbf,0x59,0x18,0xe9,0x02,
+  0x42,0xf0,0x97,0xce,0xd4,0x84,0x6c,0x3c,0x4a,0x4c,0x9f,0x07,0x57,0x12,0x09,0xa3,
+  0x28,0x2b,0x06,0xbe,0x04,0x2e,0xfc,0xc7,0x84,0xb3,0xb2,0x7d,0x39,0x06,0x22,0x60,
+  0x09,0xd8,0x60,0xaf,0x9e,0x9f,0xc3,0x26,0x2e,0x92,0xd8,0x83,0x4d,0x43,0x45,0xba,
+  0x13,0x44,0x5f,0x73,0x20,0x30,0xb7,0xa5,0x0d,0x7d,0x71,0xb7,0xf6,0x6c,0x0e,0xcb,
+  0x30,0x44,0x19,0x24,0x02,0xd6,0x8f,0xd1,0xc6,0x98,0x30,0x33,0xe5,0xb3,0x0c,0xf1,
+  0xc1,0xba,0x13,0xd6,0x6d,0x31,0x98,0xaf,0x66,0xad,0x53,0x7e,0x0f,0x02,0x5c,0xb1,
+  0x2e,0x5b,0x57,0xa6,0x48,0xe9,0xad,0x96,0xa9,0x62,0x36,0xab,0xf2,0xf0,0xc5,0x0b,
+  0x0a,0x8a,0x57,0xa6,0x04,0x6b,0x9b,0xdd,0x14,0xf0,0xc8,0xa4,0x28,0xde,0xea,0xb6,
+  0x56,0x6a,0xc9,0x5f,0xa2,0xe9,0x32,0x71,0x4b,0x4b,0x7e,0xcf,0x45,0xc9,0x6f,0xa3,
+  0x08,0x67,0xc1,0x95,0x18,0x88,0x55,0xea,0xbd,0xcc,0x7f,0x7e,0x9e,0xbd,0x4c,0x02,
+  0x23,0x79,0xe9,0x57,0xd6,0x0b,0xb2,0x3b,0xac,0x85,0xa0,0xed,0x55,0x18,0xce,0xd7,
+  0xcc,0x05,0xa3,0x4f,0x10,0x26,0x31,0xec,0x4e,0x45,0x73,0xbb,0x91,0x48,0xe7,0xb8,
+  0x00,0xd1,0xcd,0xa9,0xdf,0x2e,0x55,0x12,0x94,0x5c,0xf0,0x9f,0x95,0x3a,0x9d,0x7c,
+  0x86,0x3a,0x9d,0x2d,0x3c,0x9f,0x84,0x6c,0xc6,0xf8,0x2d,0x10,0x0b,0x2a,0x4c,0x52,
+  0x19,0xb3,0x31,0x6c,0x15,0x68,0xc0,0xc8,0xf3,0x21,0xb9,0x69,0x28,0xd1,0x2c,0x95,
+  0xb7,0x54,0xcc,0xdc,0x45,0x64,0x53,0x56,0x86,0x45,0x6b,0x4d,0xec,0xda,0xc7,0x8f,
+  0xdb,0xed,0xe3,0x93,0x16,0x4a,0x9d,0x00,0x7e,0x9c,0x03,0xee,0x20,0xb0,0xc8,0x56,
+  0x2d,0xfa,0x2c,0x72,0x1b,0xeb,0x38,0x1b,0xd0,0xee,0xe4,0x46,0x3c,0x42,0xa8,0x5c,
+  0xac,0x6b,0x75,0xff,0x96,0x42,0x6b,0xfc,0xc9,0x8b,0x17,0xb6,0x5f,0xfb,0x7f,0xe9,
+  0x05,0xb4,0xe2,0xac,0x8e,0x10,0xda,0xae,0x8b,0x82,0xab,0xb0,0x89,0x9e,0xac,0x80,
+  0x49,0xd5,0xd8,0xca,0xe0,0x99,0xeb,0x32,0x04,0x3b,0x6d,0x0a,0x80,0x4d,0xd8,0x1c,
+  0xf0,0x2f,0x11,0x29,0xc2,0x0e,0x84,0x43,0x04,0x2c,0xc5,0x46,0xb5,0x54,0xb5,0x2f,
+  0x58,0xe6,0xad,0x0c,0xce,0x23,0x7b,0xc2,0x82,0x30,0x01,0x7b,0xfa,0xf3,0x02,0x42,
+  0x44,0xd7,0x62,0x0b,0x88,0x6b,0x3e,0xcc,0x9b,0xe7,0xe1,0x32,0x40,0xf7,0x4b,0x7e,
+  0x43,0x16,0x57,0x37,0xaa,0x29,0x6e,0x03,0x65,0x58,0xc8,0x96,0x94,0x22,0xf1,0x6d,
+  0x50,0x04,0x46,0x79,0xfa,0x27,0xb4,0xf5,0x36,0x0a,0x82,0x0b,0xee,0x93,0x24,0x80,
+  0x2d,0x3d,0xc8,0xe8,0x49,0xc7,0x51,0xbf,0xc6,0x5e,0x34,0x5b,0x82,0xb6,0x42,0xfa,
+  0x33,0x9b,0x83,0x68,0x0b,0x65,0x4b,0x65,0x6c,0xab,0xce,0xa7,0x1a,0x0d,0x62,0x26,
+  0x0d,0x40,0xfb,0x33,0x0c,0xc0,0x7b,0xf0,0x45,0xf2,0x2c,0x66,0x84,0xb6,0x20,0x26,
+  0xef,0xa4,0x76,0x9f,0xa8,0x04,0xc7,0xdf,0x10,0x7e,0x57,0xba,0x57,0xfb,0x0e,0x03,
+  0x14,0x4e,0x03,0xb0,0x5e,0x22,0x42,0x13,0x04,0xb5,0x99,0xd2,0xd1,0xc6,0x67,0x28,
+  0x61,0x5e,0xa5,0x8e,0xd3,0x8c,0xe4,0x1d,0x8f,0x17,0x33,0xce,0xa0,0x27,0x11,0x53,
+  0x81,0xb8,0x8c,0xc2,0x30,0xd9,0x92,0x06,0x47,0x34,0x04,0x30,0xe4,0x73,0xcd,0x24,
+  0x5a,0x40,0xe3,0x3f,0xf3,0x2c,0xd3,0x2c,0x00,0x8c,0x6d,0x3f,0x06,0x88,0x1f,0xc2,
+  0x0c,0x60,0xdf,0x1c,0x34,0xa3,0xf7,0xcf,0xa0,0x4f,0xec,0xe2,0xf5,0x19,0x84,0x21,
+  0x18,0x07,0x14,0xc9,0xd4,0x86,0x89,0xf4,0x47,0xcf,0xd3,0xb5,0xea,0xdd,0x6c,0xb4,
+  0x88,0x87,0xf3,0x45,0x49,0x58,0x4a,0x52,0x3e,0x78,0x1e,0xd8,0x23,0x08,0x16,0x86,
+  0x6f,0x3f,0x30,0x3c,0x8e,0x12,0x31,0x07,0xc4,0x35,0x8f,0x6a,0x79,0x51,0xce,0x6f,
+  0xc0,0xa7,0xcc,0xfe,0xc2,0x0e,0x76,0xcd,0x8e,0x55,0x53,0xb2,0xdc,0xe9,0xf4,0xc7,
+  0x5b,0xa7,0xd7,0xf5,0x53,0x08,0xe3,0xb9,0x17,0x13,0xa6,0x24,0x64,0xf6,0x4d,0x08,
+  0x61,0x8f,0xe0,0xdc,0x3c,0xf4,0x7d,0xf4,0x46,0xa3,0x3b,0x92,0xc8,0x10,0xfe,0x8a,
+  0x70,0xf7,0x17,0x3e,0x6f,0xe8,0x13,0xec,0xd8,0x11,0x69,0x5d,0x94,0xb6,0x8a,0xda,
+  0x56,0x45,0x2c,0x11,0x62,0xd9,0xca,0xe0,0xc2,0xc6,0x72,0xaf,0xb4,0x24,0x9b,0xf3,
+  0x63,0x0d,0x97,0xcc,0x99,0x78,0x04,0xc4,0xbf,0xe3,0x78,0x3a,0xf3,0x39,0xe3,0x41,
+  0x05,0x70,0x38,0xfc,0xc3,0xce,0xf9,0xd8,0x5e,0xf8,0x49,0xbc,0x07,0x1a,0x0c,0xf4,
+  0x4b,0x78,0xf8,0x4c,0x66,0x25,0x10,0x9d,0xb2,0x39,0xd0,0xe6,0xf1,0x25,0xf3,0xbd,
+  0x1b,0xde,0x60,0x43,0xac,0xe6,0xb3,0x0b,0x0a,0xdb,0x43,0xb4,0x75,0x31,0xaa,0x35,
+  0x7c,0x1c,0xc3,0xf8,0x69,0x23,0x3d,0x51,0x92,0x13,0xca,0x0f,0x8a,0xa9,0x64,0xc7,
+  0x5e,0xd0,0xc9,0x3e,0x33,0x6c,0x7f,0x89,0x9a,0x7f,0xe3,0xc5,0x1e,0xec,0x97,0x70,
+  0x85,0xa9,0x55,0x14,0xc7,0xff,0xa9,0x59,0x92,0x5f,0x09,0x65,0x7a,0xbc,0xe5,0xcc,
+  0xb1,0xa6,0x2a,0x67,0xd4,0x17,0x11,0x83,0x07,0x19,0xfc,0xfe,0xdb,0x7f,0xe6,0xfa,
+  0x70,0xc4,0x0d,0x8f,0xd2,0x11,0x19,0x51,0x92,0xc6,0xd8,0x89,0xbc,0x39,0xe8,0xa5,
+  0x13,0x06,0x78,0xa0,0xec,0xf7,0x61,0xc4,0xc0,0x0d,0x1d,0x50,0xfc,0x20,0x69,0x4c,
+  0x78,0xf2,0xdc,0xe7,0xf8,0xf1,0xec,0xee,0xa5,0x6b,0x78,0x6e,0xad,0x27,0x21,0xa7,
+  0xfc,0xb6,0x73,0xd4,0x0f,0xfa,0x83,0xea,0xc3,0xea,0xa1,0x51,0x6d,0xd1,0x9f,0xea,
+  0x61,0xd0,0x48,0xc2,0x8b,0x04,0x93,0x18,0xa3,0x7d,0x5c,0xab,0x35,0x62,0xe0,0x1c,
+  0x37,0xea,0xc7,0xe9,0xb8,0x24,0x84,0x61,0x30,0xb8,0x3f,0x98,0xe3,0xa5,0xb1,0x97,
+  0x41,0x62,0xc0,0xb7,0x46,0xc4,0xc1,0x22,0x02,0x24,0x60,0x33,0xab,0xd5,0x9a,0xd9,
+  0xc6,0x11,0x07,0xcd,0x26,0xf0,0x07,0x98,0xf7,0xd6,0x9e,0xc8,0x54,0x05,0x0f,0xf7,
+  0x3c,0x87,0xc1,0x82,0x79,0xd2,0x63,0xcf,0xde,0xbe,0xa4,0x1d,0x8a,0xd9,0x22,0x70,
+  0x81,0xbb,0xcb,0xa9,0x9d,0xa0,0x4c,0x31,0xf0,0x03,0x60,0x68,0x79,0x74,0x03,0x2a,
+  0xe5,0x25,0x84,0x44,0xce,0x7f,0xf6,0xec,0xe2,0x39,0x24,0x5b,0x7e,0xe8,0x08,0x0b,
+  0x8b,0x90,0x78,0x51,0x2d,0xa5,0xa0,0xf9,0xaf,0xcd,0xc3,0x3f,0x34,0x91,0x08,0x20,
+  0x00,0x42,0x23,0x9a,0x92,0xf7,0x83,0x85,0xef,0x9b,0x2c,0xbe,0x0b,0x1c,0x58,0x5b,
+  0x9f,0x2c,0x1c,0xf4,0x23,0x85,0xaf,0xd0,0x2e,0x89,0x50,0x0f,0x93,0x50,0x32,0xef,
+  0x78,0x4a,0x28,0x2b,0x7e,0x18,0xf7,0x78,0x40,0xdd,0x2d,0x50,0x39,0x5b,0xa0,0xf1,
+  0xb5,0x13,0xf0,0x02,0x94,0xba,0x10,0x18,0x1d,0xc7,0x48,0xea,0x5e,0xbf,0x39,0x7f,
+  0xfe,0x97,0x57,0xcf,0xce,0x9e,0xbf,0xba,0xe8,0x5f,0x56,0xe8,0xac,0xb0,0x62,0x56,
+  0xe4,0x51,0x20,0x7c,0xca,0x4e,0xfa,0xe0,0x8b,0x38,0xc8,0x83,0x0f,0xf2,0x9c,0x0e,
+  0x3e,0xe5,0x8e,0xe1,0xf0,0xbb,0x38,0x65,0xa3,0x91,0x33,0xd0,0x15,0xb3,0x22,0xce,
+  0xc8,0xb0,0x21,0x3d,0x02,0x83,0x2f,0xe2,0x80,0x0b,0x3e,0xe4,0x8f,0xaf,0xb0,0x47,
+  0x3f,0x9c,0xd2,0xbf,0x8b,0x19,0x88,0x2d,0x95,0xdc,0x39,0x11,0x62,0xd1,0x4e,0x81,
+  0x2a,0x57,0xc0,0xa7,0xf1,0x22,0xa0,0x9a,0x12,0x8b,0xa7,0xe1,0xf2,0xcd,0x3c,0x89,
+  0x5f,0x84,0x91,0x81,0x5e,0x88,0x4e,0xe7,0xc5,0xda,0x41,0x25,0x60,0x63,0xee,0x49,
+  0x61,0x45,0xcc,0x6b,0xc1,0xa7,0xcb,0x96,0xd9,0x36,0x3b,0x66,0xd7,0x3c,0x32,0x1f,
+  0x99,0xc7,0xe6,0x63,0xf3,0xc4,0x7c,0x62,0xb6,0xa1,0xb1,0x6d,0xe2,0x35,0x81,0xae,
+  0xd9,0x3e,0x32,0xdb,0x8f,0x40,0x5e,0xae,0xcc,0x6c,0xe4,0x19,0x8d,0x54,0x90,0x05,
+  0x30,0xe8,0x82,0x5d,0x8b,0x24,0x79,0x90,0xd3,0x86,0xa1,0xcf,0xea,0x03,0x36,0x0d,
+  0x93,0x0c,0xc3,0x90,0x30,0xa8,0xa1,0x3a,0xee,0xf3,0xb2,0x1e,0x19,0x44,0x5b,0xeb,
+  0x3d,0xe2,0x26,0x02,0x7e,0xba,0xec,0xc2,0x0a,0x24,0xfd,0x82,0x1e,0x41,0x0c,0xfd,
+  0x01,0x8a,0x72,0x9c,0x65,0xdf,0xc8,0x20,0xda,0x64,0x63,0x60,0xe6,0xc8,0xb7,0x21,
+  0x9d,0x20,0x84,0xe9,0x59,0x89,0x45,0x08,0x05,0x4b,0x4a,0xb8,0x41,0x38,0x25,0x5d,
+  0x30,0x1e,0xa2,0x61,0xd8,0xd7,0x38,0x1c,0xe3,0xad,0x91,0x89,0xc4,0x25,0x22,0x21,
+  0xb1,0xa0,0xa3,0x2b,0x68,0x5a,0xf5,0x0e,0xd2,0xfd,0x80,0xdd,0xea,0xb3,0x6b,0xd6,
+  0x1f,0x30,0x03,0xb6,0xe6,0xf2,0xfa,0xea,0xd7,0x5f,0x2f,0xaf,0x6a,0x0d,0x2f,0x70,
+  0xfc,0x05,0x10,0x23,0xb6,0xaf,0x97,0x82,0x0b,0x3f,0x08,0x43,0x0c,0xc7,0x87,0xec,
+  0xfe,0x8e,0xc7,0x35,0xcd,0x90,0xfc,0xbc,0x80,0xec,0xfd,0x42,0x2a,0x04,0x18,0x5a,
+  0x04,0xaa,0x35,0x40,0x67,0x30,0x24,0x32,0xc0,0x8c,0x04,0x0d,0x32,0x63,0xaf,0x40,
+  0x19,0xe4,0x2d,0x2a,0xa3,0x8a,0x61,0x59,0xd5,0x7c,0x80,0xa8,0x6a,0x44,0x18,0xac,
+  0x68,0x84,0xcc,0x21,0xeb,0x29,0xc2,0x3c,0xf0,0x6c,0x48,0x08,0x74,0xaa,0x51,0x8d,
+  0xec,0x38,0xa6,0x6a,0xc2,0x2a,0x8c,0xaa,0xfc,0x52,0x23,0x6a,0xd7,0xc1,0xce,0x74,
+  0xb0,0xb3,0x8d,0x60,0x43,0x1d,0x6c,0xb8,0x11,0xec,0x5c,0x07,0x3b,0x2f,0x03,0x93,
+  0x9b,0x22,0xe1,0xd4,0xb7,0x12,0x40,0x92,0x1d,0x00,0x23,0x38,0xf1,0xa5,0x04,0x2a,
+  0x15,0x08,0x89,0x30,0xfb,0x5e,0x46,0x22,0xed,0xb8,0x22,0x51,0x7c,0xc9,0x98,0x3b,
+  0x5e,0x44,0x14,0x21,0x80,0x01,0x9f,0x31,0x79,0xe0,0xd3,0x3c,0x47,0x1e,0x2b,0x41,
+  0xc2,0xbb,0x1d,0xa2,0x92,0xa5,0x5a,0x44,0xa2,0x8b,0xf1,0xb7,0x50,0x28,0xc0,0xe4,
+  0x8d,0x99,0x91,0x5f,0x5a,0xaa,0xd6,0x28,0x29,0x73,0x07,0xa4,0xe4,0x70,0x93,0x8f,
+  0xa9,0xea,0x09,0x69,0xb5,0xd6,0xa0,0x98,0x92,0xfd,0xfa,0x2b,0xeb,0xf4,0x08,0xc7,
+  0x66,0x91,0xca,0xed,0xd5,0x9e,0xc2,0x85,0xc4,0x9c,0xb2,0xae,0xe0,0xd4,0x9e,0xc8,
+  0xcf,0x3f,0x0d,0xf9,0x91,0x40,0xbe,0x02,0xe7,0x0a,0xa2,0x7b,0xff,0x55,0x16,0x01,
+  0x19,0xa3,0x9c,0xe4,0x6b,0x51,0x5e,0xc4,0x88,0x57,0x97,0x32,0xb3,0x3d,0xf6,0x7c,
+  0x1f,0x4c,0xf6,0xcc,0x88,0xc9,0x60,0x73,0xc0,0x8a,0xfb,0x9e,0x6e,0x0f,0xfd,0xe9,
+  0xb3,0xb8,0x81,0xad,0x3d,0x09,0x91,0x1d,0xd0,0x2b,0x38,0x84,0xc8,0x5a,0x15,0x1c,
+  0x45,0xbe,0x39,0x54,0x08,0x47,0xad,0x0a,0x44,0x93,0x69,0x09,0x86,0x20,0x69,0xab,
+  0x02,0x93,0x3a,0x52,0xc0,0x44,0xad,0x0a,0x64,0x3c,0x8f,0xf3,0x54,0x13,0x08,0xb4,
+  0xa2,0x88,0x1d,0xb7,0x14,0x58,0x76,0x38,0xae,0xd3,0x9e,0xb5,0xb2,0xa7,0x4f,0xd9,
+  0x51,0x2b,0x05,0x57,0x16,0x26,0x43,0xdc,0x17,0x11,0x92,0x11,0x37,0x44,0x5f,0x2d,
+  0x07,0x7a,0xb6,0x05,0xf4,0x2c,0x0f,0x3a,0xdc,0x02,0x3a,0x44,0xa2,0x5b,0x79,0xf8,
+  0xf3,0x2d,0xf0,0xe7,0x79,0xf8,0x52,0x4d,0xc3,0x75,0xea,0x1d,0xa9,0xea,0x81,0xe0,
+  0x18,0x18,0x0f,0x79,0xfd,0x56,0xcf,0x3b,0x3d,0xea,0x79,0x87,0x87,0xb5,0x7b,0x31,
+  0x6f,0xf5,0xd0,0xd3,0x87,0x3b,0x38,0xee,0xd2,0xbb,0xea,0x81,0x25,0x80,0xa9,0x67,
+  0xf6,0xed,0x5b,0x1e,0x0d,0xa7,0x35,0x0d,0x18,0xda,0x84,0xbc,0xc8,0xbe,0x1e,0x08,
+  0xdc,0x81,0x74,0xcc,0xe2,0xc4,0x04,0x42,0xeb,0x49,0x9c,0x7a,0x17,0x68,0x25,0x78,
+  0xd5,0x0b,0x44,0x5d,0x52,0x10,0x66,0xae,0xfd,0x7d,0xb5,0x89,0x58,0x76,0x2f,0x91,
+  0xa1,0x63,0x43,0x52,0x00,0x19,0x12,0xd3,0x23,0x83,0x15,0xd4,0x18,0xe8,0x83,0x28,
+  0xdf,0x40,0xff,0x83,0x07,0xd0,0x4b,0x6b,0x50,0x84,0xfd,0xf0,0xfc,0x47,0x25,0xfa,
+  0xea,0xb0,0x03,0x98,0xa6,0x8f,0xc0,0xe5,0xc8,0x9e,0x74,0x4b,0xd2,0x5a,0xd1,0x1a,
+  0x6c,0xd6,0x95,0x07,0xbe,0xe0,0x3f,0x6b,0x9b,0x61,0x28,0x40,0x68,0x66,0xdf,0x7c,
+  0xc3,0x64,0x70,0xad,0xb5,0xd6,0x1a,0xe0,0xdc,0x27,0x09,0xb0,0xf7,0x29,0xd3,0x81,
+  0x2d,0x56,0xb9,0xbc,0xaa,0x28,0xdc,0x74,0x66,0x90,0xc7,0x4b,0x4d,0x39,0x9c,0xd4,
+  0x92,0xc7,0x27,0x80,0x14,0x2e,0x89,0x4c,0x14,0x06,0xf2,0x82,0x86,0x7b,0x83,0xad,
+  0x6f,0x82,0x33,0x48,0x5b,0x60,0x6c,0x15,0xeb,0x04,0x55,0x18,0x5a,0xa5,0x6d,0xa9,
+  0xa6,0xea,0x2e,0x53,0xf2,0x8c,0x21,0x82,0x1f,0x9c,0x72,0x61,0xe8,0xc8,0x01,0x42,
+  0x28,0x59,0x0e,0x08,0x1d,0xa9,0xdb,0x12,0xb9,0x15,0x16,0x6d,0xd2,0x04,0x0b,0x03,
+  0xcd,0xa0,0x26,0x31,0x81,0xcc,0x00,0x12,0xec,0x1f,0x8a,0x37,0x28,0x40,0x6f,0xf5,
+  0xa6,0xca,0x0e,0x91,0x0d,0x54,0xb1,0xf9,0x13,0xe6,0x74,0xa0,0xd6,0x20,0x57,0xd5,
+  0xdf,0x7f,0xfb,0x8f,0x6a,0xa6,0x53,0xf3,0xbb,0xb5,0xa1,0x28,0xe1,0xf3,0x3b,0xb2,
+  0x63,0x34,0xe0,0x7f,0xfe,0x9b,0x9d,0xdb,0xd1,0x35,0x56,0x73,0x44,0xd0,0x16,0xb3,
+  0x4e,0xab,0xf3,0xa8,0x4a,0xf4,0xe9,0x11,0xaf,0xb0,0x8f,0xbf,0xb6,0x52,0x87,0x2b,
+  0x2a,0xc7,0x98,0x9a,0xdf,0x50,0x69,0x54,0xab,0x19,0x61,0x35,0x19,0x93,0x6b,0x97,
+  0x2a,0x5d,0xe8,0xc7,0xa3,0xbb,0x9c,0x1b,0x8d,0xa9,0xd6,0xdd,0xa7,0xee,0x06,0x25,
+  0x53,0x39,0x59,0x01,0xc2,0x70,0xcf,0xa4,0x7b,0x80,0x74,0x49,0x15,0x47,0x3f,0xbc,
+  0x34,0x9e,0x61,0x69,0xbc,0xe1,0xc5,0xf4,0xaf,0x41,0x88,0x68,0xb7,0x09,0xa3,0xc5,
+  0x20,0xcc,0x13,0x1e,0xcb,0xc1,0x54,0xc5,0xf8,0x8b,0x88,0xd2,0x8b,0x48,0x14,0x54,
+  0xce,0x51,0x4c,0x30,0x51,0x89,0x0c,0x2d,0xac,0x57,0x1a,0xdb,0x4f,0x43,0xf9,0x2b,
+  0x50,0x93,0xb9,0xe1,0x61,0x64,0xf9,0xe0,0x81,0xa6,0x87,0x6a,0x97,0x09,0x6d,0xc4,
+  0x93,0x45,0x14,0xc8,0x05,0x23,0xd7,0xac,0xc3,0xa2,0xd7,0x11,0x01,0x76,0xe6,0x4f,
+  0x04,0xc4,0xba,0xd7,0x11,0x70,0xe4,0x4f,0x04,0x48,0xce,0xe1,0x98,0x85,0xa8,0xfa,
+  0xb0,0xd4,0xdf,0xe8,0xc1,0xfc,0xe1,0x9a,0xab,0x11,0xbd,0xe0,0x44,0x44,0x9f,0xe6,
+  0x63,0x44,0x4f,0xe6,0x37,0x04,0xc0,0xba,0x77,0x31,0xf5,0xb4,0x07,0x73,0x64,0x63,
+  0xdd,0xad,0xd4,0x72,0x19,0x4e,0x1e,0xe8,0xac,0x0c,0x68,0x58,0x00,0x1a,0x96,0x01,
+  0x9d,0x17,0x80,0xce,0x0b,0x40,0xba,0x2f,0x10,0xd4,0x97,0xb9,0x0d,0x85,0x10,0x81,
+  0x2e,0x09,0xca,0x69,0xa5,0x7d,0xe2,0x7b,0xbb,0xf0,0xbd,0x53,0xf8,0xde,0x55,0xdf,
+  0x65,0xe6,0x24,0x05,0xc7,0x92,0xff,0xaa,0xc6,0xcc,0xc6,0x58,0xc6,0xba,0x2d,0xea,
+  0xf7,0xfb,0xc2,0xee,0x48,0xea,0x53,0xa3,0x62,0x95,0x9b,0x1e,0x1d,0x0a,0x2c,0x8a,
+  0x55,0x6e,0x77,0x4c,0x51,0x19,0x4b,0x9d,0x00,0x48,0xa4,0x32,0xf4,0xd6,0x26,0x8f,
+  0x60,0x6a,0x19,0x16,0x1a,0x79,0x6b,0xa3,0x3f,0xd0,0x21,0x41,0x73,0x2d,0x66,0x94,
+  0x3b,0x03,0xa5,0xd1,0x26,0x12,0x72,0xcd,0xe7,0xe0,0xdd,0x02,0xaa,0x48,0xa8,0xf2,
+  0x9e,0xb4,0x21,0xa2,0x12,0x4d,0x48,0x7f,0x11,0x87,0xe3,0xf4,0xcf,0x1f,0x63,0x88,
+  0xc9,0x89,0x2d,0x90,0xe5,0xad,0xa8,0x74,0xf1,0x26,0xf0,0xef,0x40,0xab,0x21,0x35,
+  0x14,0x66,0x3e,0x99,0xda,0x10,0x9e,0xa3,0x29,0xe9,0x61,0xcd,0xdd,0xf6,0xc7,0x75,
+  0x2c,0x5c,0xba,0x84,0x92,0x8e,0x5d,0x45,0x65,0x9b,0x8a,0xc8,0x93,0x30,0x04,0xd3,
+  0x85,0x8c,0x6b,0x50,0x9d,0x04,0x1b,0xc5,0xf1,0x77,0x5f,0x7a,0x8b,0xd4,0x2a,0x68,
+  0xf3,0x6b,0xf9,0x3e,0x7a,0xa1,0x75,0xd7,0x84,0xab,0xac,0x80,0xc5,0x85,0x14,0xc4,
+  0xa8,0xa9,0x35,0xf7,0x94,0xfd,0x23,0x57,0x9d,0x37,0x5f,0x9a,0xfd,0xbb,0xa9,0x41,
+  0xaa,0xa1,0xd3,0x71,0xd3,0xcb,0x59,0xb1,0x55,0x66,0x58,0x52,0x28,0xe2,0x85,0x4d,
+  0x6c,0x4c,0xe9,0xc5,0x72,0xa4,0x20,0x55,0x15,0x7c,0x50,0xa6,0x24,0x11,0xba,0x0d,
+  0xfe,0x08,0x73,0xd8,0x4b,0x1b,0x98,0x33,0xe6,0x38,0x09,0x56,0x97,0x0e,0xab,0x4d,
+  0x7b,0xee,0x35,0x7d,0xee,0x02,0xcc,0xd8,0x9b,0x54,0xcd,0x7b,0x07,0x02,0x6e,0x6e,
+  0x55,0x83,0xb0,0x0e,0x7b,0x1a,0xf1,0xea,0x0a,0xd6,0x07,0x39,0x94,0x11,0xf5,0x07,
+  0x51,0xe3,0x23,0xf1,0x45,0xd9,0x69,0x2c,0x36,0x01,0xd2,0x8f,0x3d,0x2d,0xe6,0xc6,
+  0x36,0xd9,0xbf,0xc9,0x25,0x7d,0x2c,0xb8,0xa4,0x6a,0x06,0x5e,0xe6,0xfc,0x3e,0xe6,
+  0xbd,0xde,0x53,0xf4,0x86,0x87,0x85,0x46,0x2b,0x87,0x45,0xdc,0xaa,0xcf,0x23,0xea,
+  0x83,0xf2,0xd9,0xee,0x1d,0x41,0xad,0x04,0x97,0x95,0xab,0x40,0xf6,0x84,0x20,0x19,
+  0x7e,0x38,0x31,0xaa,0xc8,0x4e,0x26,0x98,0x21,0xf8,0xc4,0xc6,0xb6,0x07,0xfc,0x81,
+  0x0c,0x49,0x5f,0x57,0xf9,0x14,0xe1,0x78,0x8c,0xc7,0x75,0x62,0x12,0x6d,0x47,0x64,
+  0x09,0x6e,0x95,0x55,0x09,0x5f,0x41,0xf6,0x49,0x8f,0x4c,0xa3,0xd0,0xb7,0x64,0x25,
+  0xd7,0x15,0x47,0x46,0x31,0xc3,0xb7,0x0c,0x24,0xbb,0x3f,0xf2,0xd1,0x45,0x08,0x6a,
+  0x97,0x98,0xec,0xed,0x9b,0x8b,0xf7,0xcc,0x8e,0x81,0x1a,0xdf,0xc7,0x57,0x12,0xa2,
+  0x4e,0x88,0xb2,0xbc,0x8c,0x65,0xc1,0x6f,0x19,0x7f,0xc7,0x83,0x7e,0x0b,0x3f,0x5c,
+  0x20,0x39,0xaa,0xf5,0x15,0x88,0xcf,0xb9,0x37,0x1e,0xa7,0x0d,0xef,0xbd,0x19,0x8f,
+  0x04,0xe0,0x19,0xa0,0x02,0xaa,0xfb,0x8f,0x30,0x3f,0x50,0x9a,0x81,0x47,0xa0,0xd8,
+  0x1d,0xf1,0x19,0x04,0x2b,0xaf,0xe3,0x09,0x8d,0x54,0x55,0xd1,0x80,0x2f,0x79,0x04,
+  0x33,0xc1,0xd6,0x4c,0xd0,0x2f,0x4e,0x1e,0xf4,0xfb,0x34,0x35,0x86,0x67,0x86,0x31,
+  0x61,0x75,0x41,0x49,0x8d,0x0d,0x06,0x03,0x88,0xe0,0x21,0xad,0x6c,0xdd,0x9e,0x88,
+  0xa2,0x6b,0x4b,0xaf,0xaf,0xe1,0x65,0x93,0xbb,0x77,0x34,0x87,0x31,0x5b,0x97,0x60,
+  0x59,0xcc,0x9c,0x35,0x9c,0xf1,0x64,0x5d,0xc2,0x8a,0xbc,0x65,0x6a,0xd5,0xca,0xab,
+  0xf7,0x24,0x3f,0x66,0x90,0xb4,0x07,0xc8,0xfb,0x74,0xde,0x65,0x0c,0x1b,0x16,0x40,
+  0xce,0x29,0xd4,0x06,0xd5,0x84,0x98,0xc8,0x97,0x19,0xc3,0x0d,0x23,0xab,0xba,0x46,
+  0x61,0x12,0x82,0xbb,0x41,0x73,0x3d,0x4d,0x12,0x70,0x9c,0xd5,0xa7,0xd5,0x25,0xb8,
+  0xf0,0x66,0xb3,0x6a,0xc1,0x07,0xfc,0xb7,0x76,0x98,0x82,0x4f,0xc3,0x38,0x39,0x94,
+  0xba,0xb5,0x04,0x09,0xe9,0x91,0x24,0xa4,0x12,0xa7,0xb6,0xab,0x27,0x95,0x5b,0x74,
+  0x2f,0xe3,0x46,0x18,0x84,0x73,0x20,0xd7,0xa8,0xf5,0x07,0xf7,0x85,0x8d,0x41,0x23,
+  0x28,0x61,0x1c,0x3f,0x8c,0x79,0x0a,0x24,0x31,0x69,0xfb,0xdd,0xc3,0xc0,0x07,0xf7,
+  0x37,0x5c,0x24,0x46,0xba,0x50,0x6d,0xa7,0x89,0x2f,0x0a,0xf9,0x6b,0xe0,0x55,0x63,
+  0xe6,0x05,0x46,0xda,0xf4,0x6d,0xc7,0x64,0xb8,0x57,0x35,0x7d,0xd2,0x19,0x04,0x28,
+  0xf6,0x84,0xf7,0xf9,0x0d,0x4c,0x4b,0x2a,0x80,0x92,0x32,0xeb,0x09,0xd6,0xcd,0xfa,
+  0x9a,0x55,0xe3,0x37,0x0d,0xd7,0x4e,0x6c,0x1c,0x9e,0x2d,0x59,0x5f,0x29,0x56,0x5c,
+  0x8c,0x19,0xa4,0xf9,0xc8,0x4e,0x98,0xb3,0x2a,0x95,0x50,0xb5,0x5f,0x13,0x8b,0xb2,
+  0x8d,0xdb,0xa2,0x6d,0x58,0x4d,0xaf,0x2a,0xac,0x4c,0x94,0x2c,0x08,0x09,0x8f,0x22,
+  0xc4,0x0e,0xa3,0x7c,0x08,0xea,0x41,0x2a,0x33,0x1d,0x00,0xec,0xd9,0x9f,0x26,0x16,
+  0x19,0x81,0x55,0x10,0x0b,0xd3,0x60,0xa5,0x86,0x5e,0x62,0x01,0xcd,0x75,0x72,0x36,
+  0xe1,0x22,0x52,0x97,0xb3,0xd2,0x53,0xb3,0x1c,0x7d,0xc0,0x21,0x04,0x14,0xa6,0x3d,
+  0xa6,0xec,0xc4,0x1b,0xdf,0x19,0xf7,0xe0,0x45,0x21,0xfa,0x00,0x16,0x54,0x4d,0x80,
+  0xb3,0x68,0x8c,0x09,0xa2,0x6c,0x65,0xc4,0xac,0x94,0x25,0x65,0x72,0x11,0x2b,0x6d,
+  0x11,0x82,0x43,0xd2,0x2c,0x93,0x6a,0x89,0x69,0xfb,0xfd,0x16,0x5a,0x4d,0xa5,0x85,
+  0x06,0x91,0x01,0xbe,0x44,0xb1,0x11,0x16,0xf5,0x2c,0x10,0x87,0x67,0x8e,0xef,0xa1,
+  0x09,0x35,0x42,0x61,0x4d,0xde,0x0e,0x51,0xe5,0x58,0x93,0xfd,0xf9,0xec,0xf5,0xb0,
+  0xa6,0xad,0xb6,0xc7,0x5c,0x88,0xee,0xc0,0x2f,0x90,0x49,0xb6,0x03,0x59,0x1d,0x63,
+  0x6e,0x64,0x4f,0xb2,0xcd,0x39,0x07,0xbd,0x6b,0x04,0xe1,0xd2,0xa8,0xd5,0x95,0x91,
+  0x00,0xd5,0xc6,0x7b,0x1f,0xb4,0xc5,0xca,0x54,0xcc,0x72,0x22,0x38,0xf6,0x17,0xf1,
+  0x54,0xe8,0xb8,0x29,0x60,0x0b,0x1b,0x96,0x37,0x02,0x82,0x1d,0x2b,0xe5,0xf7,0xb3,
+  0x9a,0x4e,0x86,0x46,0x28,0x2d,0xd0,0xf3,0x20,0x9d,0x13,0xf9,0xb1,0x85,0x3a,0x25,
+  0x7f,0x62,0x58,0x39,0x17,0x53,0x5c,0x82,0x9b,0x39,0xb2,0xd2,0x3e,0x19,0xec,0xe7,
+  0x8d,0x62,0xce,0xb0,0xbc,0x40,0x3a,0x05,0x85,0xa9,0x99,0x95,0xf3,0x3e,0x58,0x52,
+  0xd9,0x66,0x89,0xb9,0x27,0x38,0xa2,0x0b,0x34,0x63,0x60,0x39,0xdb,0x3a,0x79,0xc2,
+  0xc0,0x3a,0x8b,0x28,0xb5,0x62,0x26,0x73,0xd1,0x72,0xdf,0xaf,0x54,0xa1,0x40,0x80,
+  0x5c,0x63,0x38,0x05,0x70,0x35,0x89,0x19,0xf5,0x1f,0xb1,0x17,0x84,0x10,0x20,0x2e,
+  0xaf,0xaf,0x6a,0x30,0x4d,0xa1,0x43,0x8c,0xc0,0xbe,0x1a,0x4d,0x00,0x9f,0xfa,0x02,
+  0x58,0xb3,0xa4,0xd0,0xa0,0x68,0x7f,0x33,0xfa,0x08,0x66,0xa4,0x71,0xcd,0xef,0x62,
+  0x03,0xe1,0xb3,0xbc,0x3b,0x23,0x5e,0x73,0x34,0x08,0x22,0xad,0xc7,0xa7,0xe9,0x86,
+  0xab,0xb4,0x62,0x3d,0xce,0x91,0xa7,0x9c,0xe9,0xf6,0x4b,0xfb,0xaf,0x53,0x90,0xfa,
+  0xae,0x4c,0x18,0xd2,0x4d,0x17,0x66,0x40,0xe3,0x7d,0x1f,0x79,0x7f,0x2f,0xf9,0x47,
+  0x5b,0x55,0x4b,0xf7,0x2c,0x67,0x43,0x69,0x4f,0x4d,0xd6,0x45,0xd1,0xd5,0x2d,0x99,
+  0x4a,0x19,0xe3,0xad,0x71,0x95,0x24,0x1b,0x02,0xab,0x19,0x4f,0xa6,0xa1,0x6b,0x55,
+  0xd1,0x93,0x57,0x4d,0x7c,0x63,0x08,0xc1,0x8b,0x75,0x5f,0x95,0xf6,0xac,0xfe,0x1e,
+  0xa2,0x57,0x70,0x28,0x74,0x05,0x53,0xf8,0x92,0x26,0x86,0x5b,0xd5,0x95,0x89,0x2f,
+  0x11,0xad,0x02,0x0f,0x95,0x80,0xd4,0x56,0x69,0xfa,0x5f,0x66,0x25,0x81,0x36,0xa0,
+  0x10,0xcc,0x2a,0xc6,0x4d,0x64,0x30,0x31,0x56,0x02,0x03,0x19,0x46,0x55,0xe4,0x72,
+  0x81,0xc9,0x98,0xc4,0xe7,0x13,0xe2,0xed,0xab,0x43,0xf8,0xbf,0x8b,0xa5,0x51,0xf5,
+  0x61,0xfb,0xda,0xe8,0x04,0x5e,0x9d,0xbc,0x7f,0xca,0x22,0x69,0x60,0x71,0x95,0x9f,
+  0x40,0x9b,0x18,0xaf,0xd3,0xc6,0x64,0xd4,0x9e,0x0b,0x09,0x9f,0xdf,0xe0,0xc0,0x91,
+  0x17,0xe0,0xdb,0x4f,0x66,0x8c,0xbd,0x5b,0x71,0x6d,0xa9,0x2a,0x0c,0x75,0x55,0x5c,
+  0xd0,0xa3,0x62,0x79,0x5c,0x13,0xe1,0x5f,0xba,0x36,0x1c,0x65,0x78,0xae,0x09,0x79,
+  0x50,0xe0,0xfa,0x28,0xca,0xd9,0xf2,0x30,0x50,0xdb,0x7a,0x48,0x2e,0x0e,0x41,0x1e,
+  0x04,0xeb,0x96,0x88,0x0a,0x99,0x46,0xd0,0x48,0xec,0xc9,0x0f,0xf8,0x1e,0x0c,0x74,
+  0x86,0x55,0x2f,0x9e,0xbf,0x7a,0x3e,0x7c,0x5f,0x25,0xf3,0xd9,0xa0,0xdf,0x5a,0xa1,
+  0x66,0x75,0x5f,0xa4,0x8a,0xd5,0x99,0x94,0x66,0x58,0x34,0x5d,0x31,0xa1,0x45,0x07,
+  0x58,0xb9,0xa7,0x65,0x62,0x19,0x9f,0x07,0xb0,0xc9,0xfc,0x26,0xa3,0x39,0xcb,0xf4,
+  0xc4,0xa5,0x1f,0x81,0x03,0x98,0x30,0x77,0x31,0xd1,0x50,0xf7,0x76,0xb2,0xf3,0xb4,
+  0x84,0xce,0x76,0x84,0x82,0x1d,0x10,0x0b,0x44,0xcd,0xc5,0x64,0x90,0x8d,0x41,0x64,
+  0x7a,0x5f,0x28,0x69,0x6d,0x3e,0xc7,0xd1,0x4b,0x35,0xc4,0x91,0xd4,0xda,0x00,0x51,
+  0xf2,0x74,0xff,0xad,0x7e,0xac,0xe4,0xe0,0x5d,0x06,0xa2,0x8f,0x2d,0xa7,0x1e,0x64,
+  0x09,0x54,0x8f,0x60,0x73,0x3a,0x8a,0x16,0x47,0x4c,0x54,0xd5,0x63,0xc6,0xb0,0x79,
+  0x5e,0x93,0xc4,0xe5,0x8a,0x11,0x7f,0x1b,0x22,0x29,0xaf,0x50,0x17,0x42,0xc6,0xd2,
+  0xf1,0x83,0x00,0x26,0x07,0x97,0x7a,0xb5,0xc9,0x94,0x75,0x25,0x93,0xea,0x3f,0xa6,
+  0x5e,0xe4,0x31,0xb5,0x82,0x92,0x29,0x4b,0x47,0xa6,0xaa,0xee,0x98,0xaa,0x82,0x63,
+  0xaa,0x2a,0x8d,0xa9,0x2a,0x31,0xa6,0xaa,0x6e,0x98,0x59,0xe9,0xc2,0xcc,0xea,0x13,
+  0x90,0xcb,0x63,0xed,0xac,0x45,0x70,0x37,0x6d,0xf1,0x4f,0x47,0xfc,0xd3,0x45,0x2c,
+  0xd8,0xe3,0x60,0xbb,0x83,0xad,0x4e,0x97,0x46,0x64,0xb5,0x0a,0x53,0x2f,0x47,0xe0,
+  0xf1,0x6f,0x7a,0x38,0xe4,0xb9,0xc8,0xc6,0x54,0x03,0xe4,0xe2,0xd1,0x89,0xe8,0x09,
+  0xfb,0x9a,0xe4,0x29,0x11,0xcd,0x46,0x64,0x97,0x38,0xd4,0x9f,0xb5,0xcb,0xa1,0x1f,
+  0x5e,0xd2,0x01,0x33,0x56,0x2e,0x28,0xff,0x44,0x4d,0xd3,0x07,0x68,0x97,0x07,0x12,
+  0x3e,0x7f,0x2f,0x7f,0x33,0xc0,0x10,0xea,0x88,0x91,0x19,0x5e,0xdc,0x13,0x77,0x02,
+  0xf1,0x5d,0x81,0xcc,0xf7,0x70,0x8f,0xd2,0x9b,0x81,0x74,0x3b,0x04,0x6c,0x4a,0xe0,
+  0xc6,0x10,0x5c,0x42,0x80,0x24,0x6a,0xc4,0xf2,0x28,0x5b,0x5c,0x5b,0x93,0x37,0x38,
+  0x22,0xee,0x7a,0x8e,0xba,0xb1,0x9b,0x95,0x0b,0x7e,0x5a,0xbb,0x47,0x84,0xc4,0x54,
+  0xca,0x2e,0x84,0xe1,0xcf,0x00,0x54,0xca,0x2f,0x0e,0xd2,0x0f,0x0a,0x94,0xdd,0x2e,
+  0x2d,0x79,0x55,0xae,0x5f,0xc6,0xc3,0xf0,0xbf,0x3e,0x96,0xaf,0xcb,0xd3,0x8b,0x4c,
+  0xf0,0xa5,0x2e,0x00,0x2a,0x85,0x0b,0x76,0x9b,0x6e,0x5e,0xee,0x22,0xe3,0x5c,0xde,
+  0x3b,0xcc,0x3d,0x19,0xd5,0xc1,0xc4,0xd5,0x36,0x45,0x8e,0xbb,0xc8,0xee,0x2a,0x05,
+  0x8b,0x59,0xf9,0xcb,0x55,0xf9,0x9a,0xe9,0x58,0x3c,0x23,0x4d,0x1f,0x55,0xe3,0xe3,
+  0xa6,0x7d,0x69,0xed,0x94,0xd1,0x9a,0x7b,0xaf,0xbb,0x99,0x46,0xf9,0x7c,0x57,0x3d,
+  0xf0,0x0f,0x26,0xbb,0x9e,0x98,0x66,0x2f,0xb3,0x4f,0xbe,0x90,0xc2,0xb5,0x17,0xaf,
+  0x9b,0xa9,0xd4,0x1e,0xc0,0xfe,0x5f,0x50,0x4a,0x6f,0x64,0x77,0x53,0x29,0x1f,0xcb,
+  0x6e,0xa7,0x50,0x7b,0x38,0xab,0x3d,0x4e,0x2c,0x92,0xf7,0x69,0xf4,0xbd,0x80,0xe0,
+  0x87,0xbd,0xdc,0x57,0x2c,0x6f,0xc7,0x3b,0xa5,0xb2,0xf0,0xb8,0x99,0x6e,0x7e,0x4d,
+  0x43,0xb4,0x3d,0x20,0xd5,0x22,0x9c,0xf9,0x52,0x9a,0xb7,0x3c,0x35,0x2d,0x53,0xed,
+  0xb9,0x53,0xb8,0x53,0x5c,0xfa,0xdc,0x74,0xfd,0x1d,0xe8,0xae,0xc7,0xa6,0x7b,0x8d,
+  0xc0,0x97,0xa6,0x7b,0x01,0xe2,0x33,0xd3,0x32,0xc0,0x8d,0xe6,0x67,0x9b,0xfd,0xc9,
+  0x3d,0xfb,0x7d,0x56,0x78,0x20,0xa9,0xf8,0x62,0xa7,0x7b,0xe9,0xf8,0x51,0xfe,0x05,
+  0xb0,0x22,0xea,0xe1,0x78,0x4c,0xdb,0x38,0xd8,0x6d,0xf2,0x72,0x53,0x9e,0x6d,0x98,
+  0x72,0xb4,0xd7,0x94,0xf6,0xe7,0x4c,0x39,0xdc,0x30,0xa5,0xb3,0xc7,0x94,0xad,0x16,
+  0xae,0xf3,0x93,0xa7,0x3c,0xdf,0x30,0xa5,0xbb,0xd7,0x94,0x38,0x69,0x61,0xca,0x8d,
+  0x37,0xa1,0xe5,0x0f,0xdd,0xe8,0x8a,0x23,0x2f,0xeb,0xe6,0x9f,0x21,0x10,0x05,0xb6,
+  0x83,0xbf,0x17,0x38,0x5f,0x7b,0x94,0xf0,0xfb,0xbf,0xfd,0x3b,0xfb,0x50,0xf2,0xc6,
+  0x61,0x17,0x2a,0x17,0x02,0xc3,0x12,0x64,0x7f,0x65,0xf8,0x3c,0xe1,0x33,0xd0,0x95,
+  0x90,0x76,0xbe,0x10,0xa9,0x16,0xff,0x0c,0x74,0xdc,0x5f,0x47,0x07,0x1a,0xb3,0x8e,
+  0x4b,0xbf,0xb5,0xac,0x3e,0xfe,0xd4,0xcb,0x9d,0xb1,0xce,0xec,0x6b,0x8e,0x01,0xc3,
+  0x1b,0x52,0xc3,0xd8,0x00,0xd5,0x13,0x95,0x5e,0xee,0x37,0xbc,0x00,0xe2,0xb0,0xef,
+  0xdf,0xbf,0x7e,0x05,0x49,0x86,0x76,0x99,0x94,0x4e,0x5c,0x0d,0x92,0x03,0x93,0x79,
+  0x14,0x23,0xd3,0x17,0x48,0x2b,0x7e,0x2a,0xa8,0xf8,0x1f,0xee,0xbd,0x55,0x65,0xf0,
+  0x87,0x7b,0xea,0x5f,0xa5,0xca,0xfe,0x13,0x9d,0x07,0xd4,0x1a,0x1f,0x43,0x2f,0x30,
+  0xaa,0xe2,0x7c,0x1c,0xcf,0xc3,0x42,0xbc,0xf5,0x48,0xa9,0x45,0xfb,0x08,0xe6,0x94,
+  0xc1,0x9d,0x17,0xd3,0x5b,0x11,0xf1,0xfc,0x89,0xcf,0x45,0xd4,0x25,0xde,0x3d,0x42,
+  0x42,0x18,0x2e,0xe8,0x76,0xe1,0x7c,0x11,0xcd,0xc3,0x98,0xe7,0xd6,0x06,0xf2,0xf3,
+  0x3e,0xc4,0xc7,0x2b,0x06,0x7c,0xd2,0xf2,0xc9,0x9f,0xf1,0xd8,0x1d,0xc9,0x86,0xe6,
+  0xfc,0x15,0x27,0x23,0xd6,0x2e,0x21,0xde,0x8e,0x01,0xee,0x67,0xa3,0x7a,0x29,0xa5,
+  0xfc,0x76,0x7c,0xa5,0xa2,0xfb,0x0c,0x88,0x6e,0xe8,0xf6,0xf5,0xa3,0x65,0x76,0xa8,
+  0x8d,0xc1,0x96,0xab,0xfc,0xb9,0xa6,0x7a,0x8f,0x81,0x0f,0x6f,0xb1,0xba,0x6b,0xdf,
+  0x1a,0x6d,0x93,0xa5,0x95,0x5e,0x8a,0x6d,0xcc,0x1c,0x12,0x18,0x71,0xa5,0x1f,0x69,
+  0x51,0xd1,0xac,0xa6,0x9f,0x44,0xe7,0xc0,0xa9,0xe9,0x6a,0xd3,0x91,0x74,0x0e,0x34,
+  0x6d,0xbe,0x2a,0x3b,0x9b,0xce,0x81,0x52,0x53,0x01,0x2c,0x77,0x9c,0x9b,0x83,0x46,
+  0x0f,0x74,0x55,0x7a,0x1e,0x4d,0x97,0xb6,0x0d,0x0d,0xd4,0xbe,0x2a,0x3f,0x93,0x5e,
+  0x03,0x1c,0x5d,0x95,0x9f,0x4b,0xaf,0x01,0x3a,0x57,0xe5,0x67,0xd3,0x6b,0x80,0x6e,
+  0x1e,0x70,0xa5,0x52,0x6d,0xd8,0xf9,0x07,0x98,0x32,0x43,0xaa,0x8c,0xfb,0xab,0x5f,
+  0xd5,0xea,0x67,0xbb,0xd6,0xd2,0x76,0xad,0x2d,0x77,0xed,0x76,0x0c,0x79,0x0d,0x5d,
+  0x2d,0xa5,0xb7,0xc9,0x7d,0x36,0xf1,0xc3,0x91,0xed,0x67,0xb1,0x3f,0xe2,0xcb,0x6b,
+  0x20,0x55,0x32,0x51,0x4a,0xdf,0x87,0xef,0xc2,0x25,0x8a,0xaa,0xc9,0xe2,0xa2,0xb4,
+  0x82,0x76,0x95,0xcb,0x2b,0xa8,0x2b,0x52,0x5d,0x54,0xe3,0x75,0x11,0x24,0xb0,0x4d,
+  0x92,0x29,0xee,0xf0,0x90,0xe6,0x3d,0x7d,0x2a,0x2f,0x75,0x6d,0x12,0x40,0x02,0x55,
+  0x42,0x8c,0xe0,0xa2,0x6a,0x9c,0x1f,0x91,0x97,0x41,0x31,0x46,0x3c,0x4a,0xc1,0x01,
+  0x9d,0x93,0x22,0xfc,0xba,0x20,0x8a,0x31,0x69,0xfb,0x86,0x71,0x79,0xa9,0x14,0x63,
+  0xa8,0x8d,0xee,0xd4,0x15,0xa1,0x73,0x52,0x29,0x80,0x73,0xb7,0xd3,0x60,0x4c,0xa7,
+  0x38,0x46,0xd3,0x7a,0x31,0x22,0x7f,0x6f,0x4f,0x5a,0xaf,0x52,0x79,0x5e,0xbb,0xb7,
+  0x47,0xcc,0xbd,0x15,0x0f,0x7e,0x8b,0xc3,0x46,0x1b,0x87,0x9d,0xa9,0x61,0xcf,0x4a,
+  0x86,0x39,0x1b,0x87,0x0d,0xc5,0xb0,0x56,0x0b,0xe7,0x5b,0xdb,0xd1,0x8d,0xc3,0xce,
+  0xd5,0x30,0x1c,0x58,0xcb,0x8b,0x2a,0xd6,0xeb,0xbe,0xa7,0xc7,0x73,0x2f,0xa2,0x70,
+  0xf6,0xe1,0x65,0xae,0x48,0x17,0x2e,0xb1,0x4a,0x27,0x8e,0xd3,0xf1,0xc2,0x91,0xb1,
+  0xe5,0x16,0xe9,0x43,0x7a,0xa4,0x27,0x7e,0xf7,0x4e,0x8a,0x66,0xfe,0x1e,0x12,0x62,
+  0x23,0x3f,0x93,0xda,0xf0,0xda,0xb6,0x8b,0x6d,0x85,0x02,0xa5,0xb8,0x84,0x54,0x50,
+  0xb3,0x24,0xb1,0x9d,0x29,0x68,0xd8,0x33,0x47,0xa8,0x48,0xde,0x27,0x08,0x82,0xc4,
+  0x55,0x3e,0xfa,0x5c,0xd5,0xa8,0x02,0xb7,0x4b,0x7b,0x8f,0x0e,0x6f,0x1c,0xd4,0x36,
+  0xab,0x62,0x59,0x15,0x03,0x5f,0x3f,0x54,0x69,0x1c,0x22,0x04,0x54,0x6a,0x17,0xd0,
+  0x99,0x83,0x2f,0xbf,0xca,0x2a,0x4d,0x84,0x15,0xcf,0x2f,0xb0,0xc8,0xdb,0x2b,0x61,
+  0x77,0x4f,0x2b,0x29,0xb1,0x55,0x29,0xc2,0xc5,0xfc,0x2a,0x57,0xba,0x4a,0x0f,0x2d,
+  0x7c,0x3c,0x46,0x23,0xce,0x36,0xe8,0xf3,0x0f,0xa0,0xed,0x06,0x1e,0xe4,0xca,0x43,
+  0x1d,0x5a,0x35,0x28,0x5c,0xcc,0xa3,0xe4,0x8c,0x83,0xb7,0xe5,0x06,0xc1,0x99,0x34,
+  0x24,0xe0,0xb7,0xc9,0x85,0x37,0xc2,0x07,0x60,0x12,0x5e,0xbc,0x7b,0x20,0xae,0xd2,
+  0xb3,0x13,0x5c,0x6e,0x4c,0x0f,0xf1,0xe9,0x49,0xbd,0xa8,0x83,0x10,0x64,0xca,0x7a,
+  0x62,0x4d,0x2c,0xd0,0xaa,0x3b,0x0a,0x5b,0xd7,0x88,0x46,0xb9,0x6c,0x95,0x9b,0x16,
+  0x39,0x17,0x57,0x3b,0x91,0x60,0x42,0x12,0x2e,0x62,0x59,0xa1,0x93,0xb4,0xf7,0xe4,
+  0x09,0x27,0x33,0xb0,0xbf,0x56,0xb6,0x68,0x32,0xc0,0xd4,0xfb,0x25,0x14,0x62,0x08,
+  0x59,0x4e,0x23,0x72,0x52,0xd2,0x88,0x1f,0x37,0xd1,0x87,0x7d,0xa5,0xf4,0x61,0x07,
+  0xed,0xc9,0xa7,0xd0,0x57,0xaa,0x09,0x72,0x3b,0x94,0x22,0xc0,0x86,0x52,0x54,0x2f,
+  0xaf,0xee,0xd8,0xf4,0xc3,0x17,0xa4,0x5a,0x4d,0x55,0xc3,0x65,0xeb,0x72,0x4f,0xfa,
+  0xac,0xff,0x2a,0xb2,0x7e,0x2d,0xbc,0xb8,0xf6,0xaf,0x5c,0xaf,0xde,0x58,0xb1,0x56,
+  0xfa,0xb4,0x97,0x06,0xc9,0xfd,0x2b,0xb3,0x0f,0x05,0xc6,0x89,0xa7,0xd5,0xe8,0xa5,
+  0xd1,0xc2,0x68,0xd6,0x03,0x7f,0x6f,0x53,0xaf,0xe2,0x3b,0xa8,0x19,0x5c,0x6e,0xad,
+  0x51,0x85,0xd0,0x5b,0x98,0x13,0x84,0xcb,0x85,0xd5,0xf9,0x2a,0x64,0x4f,0xb7,0xa6,
+  0xf8,0x2b,0x1e,0x08,0x3e,0xf6,0xa2,0x58,0x49,0xc9,0x70,0xea,0xf9,0x74,0x8f,0xbd,
+  0x34,0x68,0xc0,0x50,0x14,0x98,0x78,0x9f,0x1d,0x7d,0x48,0x4b,0xd6,0x00,0x70,0x1e,
+  0xb8,0x34,0xda,0x50,0x92,0x53,0x26,0x06,0x05,0x73,0x9f,0xbb,0xa2,0x29,0x8c,0xea,
+  0x4e,0x8b,0xa9,0x24,0x36,0x5b,0xa3,0xb8,0xf9,0x23,0x2d,0x69,0x14,0xa1,0x04,0x94,
+  0xde,0x19,0xfd,0xe6,0x1b,0x61,0xfe,0xf5,0x2b,0xc3,0xea,0x12,0x29,0xec,0x25,0x05,
+  0xd7,0x10,0x63,0xa5,0xf1,0x33,0xc6,0x1d,0x6c,0xc5,0xe8,0x44,0x14,0xf0,0xa6,0x52,
+  0x47,0xa1,0xbd,0xbe,0x57,0xc2,0xc1,0x94,0xc8,0x82,0x3c,0xcf,0x78,0xe6,0xba,0x4d,
+  0x7a,0xbf,0xce,0x44,0xfa,0x24,0xab,0xb7,0x72,0xe9,0x07,0xe9,0xae,0x6e,0x36,0xee,
+  0x06,0x4f,0xd5,0x1c,0x75,0x97,0x83,0x80,0x47,0x13,0x9e,0xe0,0x92,0xd4,0xe7,0x06,
+  0x96,0xc1,0x51,0xae,0x25,0x65,0x55,0xf5,0x8e,0x05,0x08,0xb8,0xc0,0xc0,0x08,0xaf,
+  0xb7,0xd0,0x16,0xd2,0x6d,0x5d,0x67,0x11,0x45,0x78,0xdc,0x24,0xe2,0x47,0x75,0x13,
+  0x29,0x66,0x71,0xc8,0xe8,0x14,0x0c,0x5f,0x09,0x42,0x70,0xb4,0xf0,0xe4,0x33,0x99,
+  0xd2,0x7c,0x44,0x65,0x24,0x2d,0x53,0x7e,0xcd,0x72,0x0f,0xfa,0x39,0x08,0xd9,0xaa,
+  0x72,0x88,0xf5,0xf7,0x13,0x98,0x6c,0x74,0x4e,0x14,0x9c,0x9e,0x44,0x94,0x3f,0xa4,
+  0xc8,0xc3,0xab,0x2c,0x62,0xfd,0x35,0x05,0xc0,0x1d,0x29,0xa8,0x42,0x12,0xb1,0xf1,
+  0x2d,0x01,0x3e,0x1d,0x50,0x63,0x72,0xb9,0xc4,0xc6,0xcb,0xad,0x85,0x54,0x62,0xe3,
+  0xfd,0xd6,0x42,0x26,0xb1,0xf1,0x8a,0x6b,0x21,0x91,0xd8,0x78,0xcb,0x75,0x25,0x6c,
+  0x53,0xd1,0x5c,0xec,0x6b,0xae,0xf7,0x11,0xa2,0xec,0x77,0x19,0x52,0x39,0xd2,0xf5,
+  0x7d,0x5d,0xfd,0xca,0x2e,0x5c,0x0b,0x8b,0x8f,0xae,0x45,0xfc,0x7a,0x80,0x2c,0x56,
+  0x92,0x0c,0xed,0x4b,0x2b,0x9d,0x6b,0x1d,0xd0,0xed,0x73,0x52,0x9d,0x83,0x8d,0xa7,
+  0x63,0x74,0x14,0xbd,0x25,0x42,0xc2,0x7e,0x40,0xb6,0x71,0xbc,0x78,0xe0,0xbd,0x0d,
+  0x03,0x9e,0xd9,0x6e,0xc7,0x80,0xe7,0xbc,0x5b,0x10,0xe4,0x4e,0xa0,0xe9,0xc9,0xae,
+  0x3c,0x05,0xf6,0xc6,0x46,0x35,0xbd,0x7a,0x56,0xc5,0xbb,0x1d,0x4b,0x2f,0x00,0x17,
+  0x5f,0xd3,0xef,0xaa,0xf5,0xf0,0x17,0x8a,0xc5,0x0b,0xe8,0xd3,0xa6,0xf8,0x71,0xe2,
+  0x26,0xfd,0xff,0x2d,0x0e,0xfe,0x17,0xf6,0x63,0x57,0xc3,0xf6,0x62,0x00,0x00,
+};
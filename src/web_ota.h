@@ -0,0 +1,162 @@
+// Generated by tools/webgz.py from web/ota.html -- do not edit by hand.
+#pragma once
+#include <Arduino.h>
+
+// 5934 bytes raw, 2447 gzip'd
+static const char    OTA_HTML_ETAG[]  = "3da92ca7";
+static const size_t  OTA_HTML_GZ_LEN  = 2447;
+static const uint8_t OTA_HTML_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xb5,0x58,0x6b,0x8e,0xe3,0xc6,
+  0x11,0xfe,0x3f,0xa7,0xa8,0x95,0x60,0x93,0xf4,0x4a,0x14,0xa5,0x19,0x79,0x67,0xf5,
+  0x32,0xf6,0x09,0x6f,0x12,0x7b,0x07,0xbb,0xb3,0x76,0x0c,0xc3,0x3f,0x5a,0x64,0x53,
+  0x6a,0x0d,0xc5,0x66,0x9a,0xcd,0xd1,0xc8,0x5a,0x01,0x3e,0x48,0x82,0x9c,0x22,0xc8,
+  0xff,0x1c,0x65,0x4f,0x92,0xaa,0x6e,0x8a,0xa2,0x34,0x0f,0xaf,0x03,0x64,0x30,0x90,
+  0x9a,0xdd,0xd5,0xf5,0xae,0xaf,0x8a,0x1a,0x3d,0x7a,0xf9,0xf6,0xc5,0xe5,0x4f,0x17,
+  0xaf,0x60,0xae,0x97,0xc9,0x64,0x54,0x7e,0x72,0x16,0x4d,0x46,0x4b,0xae,0x19,0x84,
+  0x73,0xa6,0x72,0xae,0xc7,0x8d,0x42,0xc7,0xed,0xf3,0xc6,0xe4,0xc4,0x6e,0xa7,0x6c,
+  0xc9,0xc7,0x8d,0x6b,0xc1,0x57,0x99,0x54,0xba,0x01,0xa1,0x4c,0x35,0x4f,0x91,0x6c,
+  0x25,0x22,0x3d,0x1f,0x47,0xfc,0x5a,0x84,0xbc,0x6d,0x1e,0x5a,0x22,0x15,0x5a,0xb0,
+  0xa4,0x9d,0x87,0x2c,0xe1,0xe3,0x6e,0x6b,0x77,0xab,0x1d,0x0b,0x3d,0x0e,0xe5,0x35,
+  0x57,0xc4,0x56,0x0b,0x9d,0xf0,0xc9,0xdb,0xcb,0x67,0xf0,0x21,0x8b,0x98,0xe6,0xa3,
+  0x8e,0xdd,0x39,0x19,0xe5,0x7a,0x4d,0xdf,0x00,0x03,0x25,0xa5,0xde,0xb4,0xdb,0xd3,
+  0xd9,0xa0,0xd9,0xed,0x76,0x87,0xed,0x76,0xc8,0x54,0x34,0x68,0xf6,0x7a,0x3d,0x5c,
+  0x8b,0xf4,0x6a,0xd0,0x7c,0xf5,0xea,0x15,0x2e,0x97,0x85,0x1e,0x34,0x9f,0x3d,0x7b,
+  0x8e,0xcb,0xa9,0x4e,0x91,0xa0,0xff,0xf5,0x29,0x9f,0xe2,0x93,0x44,0x92,0x1e,0x67,
+  0xc1,0xd9,0x29,0x3e,0x70,0xa5,0x06,0xcd,0xe8,0xb4,0xb7,0x45,0xd6,0x5f,0x6d,0xa6,
+  0xf2,0xa6,0x9d,0x8b,0x5f,0x45,0x3a,0x1b,0x4c,0xa5,0x8a,0xb8,0x6a,0xe3,0xce,0xd6,
+  0xb8,0xa5,0x35,0x95,0xd1,0x7a,0x33,0xe7,0x62,0x36,0xd7,0x83,0x6e,0x10,0x7c,0x41,
+  0x37,0xcc,0xde,0x94,0x85,0x57,0x33,0x25,0x8b,0x34,0x1a,0x5c,0x33,0xe5,0x92,0x6a,
+  0xde,0x30,0x94,0x89,0x54,0xe5,0x33,0x2a,0xe5,0x0d,0x63,0x74,0x4e,0x3b,0x66,0x4b,
+  0x91,0xac,0x07,0xf9,0x3a,0xd7,0x7c,0xd9,0x2e,0x44,0xeb,0x3d,0x9f,0x49,0x0e,0x1f,
+  0xde,0xb4,0xde,0xc9,0xa9,0xd4,0xb2,0xf5,0x4c,0xa1,0x93,0x86,0x4b,0xa6,0x66,0x22,
+  0x1d,0x04,0x24,0xc2,0x5f,0x29,0x96,0x6d,0x96,0x22,0x6d,0xd7,0x64,0x0f,0x23,0x91,
+  0x67,0x09,0x5b,0x0f,0xe2,0x84,0xdf,0x0c,0x59,0x22,0x66,0x69,0x5b,0x20,0xcb,0x7c,
+  0x10,0x62,0x00,0xb8,0x1a,0x2e,0x8a,0x5c,0x8b,0x78,0xdd,0x2e,0x43,0xb2,0xdb,0xce,
+  0x58,0x14,0x91,0x71,0x3c,0xbd,0x76,0x73,0x16,0xf3,0x36,0x53,0x9c,0xa1,0x7e,0x18,
+  0xdc,0xb6,0x96,0x99,0x07,0xdd,0x5e,0x76,0x03,0x77,0x9d,0xa2,0x76,0x5a,0x2e,0x3d,
+  0xa3,0x11,0xfa,0x64,0x63,0xa2,0x6a,0x75,0x59,0xb2,0x1b,0x1b,0xe4,0x41,0xbf,0x17,
+  0x64,0x37,0x3b,0xed,0xbb,0x5f,0x23,0x2b,0x56,0x68,0x39,0xbc,0xe5,0x20,0x8a,0x98,
+  0x57,0x29,0xd3,0x3d,0x47,0x42,0xa2,0x1e,0x96,0x3e,0x57,0x2c,0x12,0x45,0x3e,0x20,
+  0x5d,0x86,0x26,0x22,0x73,0x16,0xc9,0xd5,0x20,0x00,0x22,0x24,0x11,0xd0,0x0c,0x82,
+  0xe0,0x9c,0x74,0x99,0xf7,0x36,0x3b,0x67,0x41,0x60,0xb4,0x37,0x1a,0x2a,0xb9,0xda,
+  0xec,0x5c,0x34,0x53,0x22,0x1a,0xd2,0x47,0x1b,0x1d,0x84,0x3b,0x9a,0xa3,0x57,0x92,
+  0x62,0x99,0xa2,0x84,0x58,0x0d,0x67,0x2c,0x43,0x33,0xec,0x3d,0x91,0x66,0x85,0xfe,
+  0x59,0xaf,0x33,0x3e,0x8e,0x45,0xc2,0x7f,0x69,0x4d,0x0b,0xb4,0x3a,0x3d,0x34,0xd6,
+  0x48,0xf3,0x7b,0x7d,0xc5,0x97,0x10,0x54,0x46,0xf8,0x4f,0xe8,0xd9,0x3f,0xc7,0xcf,
+  0x23,0x33,0x9e,0x56,0x86,0x0d,0xba,0xa8,0x7a,0x2e,0x13,0x11,0x41,0xb3,0xdf,0xef,
+  0xd7,0xfd,0x62,0x52,0xf9,0xee,0x9c,0xc1,0x7c,0xe4,0x83,0x2e,0xf2,0x35,0x09,0x67,
+  0x15,0xba,0x9d,0x72,0x3a,0xf5,0x76,0x52,0x82,0x92,0x51,0x33,0x8e,0xe3,0x61,0x58,
+  0xa8,0x1c,0xd7,0x99,0x14,0x94,0x00,0xc6,0x39,0xb9,0x66,0xba,0xc8,0x4b,0xbf,0x51,
+  0xd8,0x8d,0xfd,0x07,0xd2,0xb1,0x76,0xca,0x50,0x33,0x55,0xe5,0xbc,0x09,0x47,0x4d,
+  0xe5,0x20,0xec,0x52,0xd1,0xdd,0xb6,0xed,0xf4,0xf4,0xec,0xd8,0x07,0x4f,0xc9,0x0b,
+  0x54,0xe5,0x71,0x82,0x91,0x9c,0x8b,0x28,0xe2,0xa9,0x11,0x80,0x7e,0x4e,0xea,0x55,
+  0x35,0xb4,0xbe,0xb6,0xe5,0xe5,0xcb,0xab,0xba,0xa9,0x89,0x48,0x39,0x53,0xed,0x19,
+  0x31,0xc5,0x7c,0x76,0x9f,0x06,0x11,0x9f,0xb5,0x9a,0xbd,0x73,0xf6,0xe4,0xac,0xdf,
+  0x6a,0x9e,0x46,0x51,0x78,0x7e,0x66,0xf5,0x2e,0xb2,0xcf,0xb8,0x78,0x16,0x3e,0x09,
+  0xe3,0xb8,0xd5,0x7c,0xc2,0xd8,0x59,0x1c,0xdb,0x8b,0x88,0x07,0x9f,0x71,0x13,0x01,
+  0xa3,0xd5,0x8c,0xfb,0x7d,0x7b,0x67,0x99,0xcf,0xea,0xde,0xc4,0x2c,0xad,0x45,0xce,
+  0x7f,0xda,0x37,0xb1,0x1b,0x75,0x2c,0x84,0x8d,0x3a,0x06,0x58,0x4f,0x46,0x84,0x1d,
+  0xf8,0x15,0x89,0x6b,0x08,0x13,0x96,0xe7,0x08,0x9b,0x58,0xe9,0x0d,0xc2,0xb8,0xfa,
+  0x26,0x16,0x80,0xd9,0xc3,0xdd,0x79,0xef,0x00,0x1a,0xf1,0xd1,0xee,0xd7,0xa8,0x31,
+  0xf1,0x4b,0x6a,0xdc,0x37,0xe9,0x0c,0x22,0x1a,0x37,0xe2,0x55,0x03,0x4c,0x5a,0x37,
+  0x28,0xaf,0x1b,0xc0,0xc2,0x90,0x67,0x08,0xd4,0xfe,0x54,0xa4,0x2d,0xfa,0xf0,0x67,
+  0xbf,0xee,0xef,0xd9,0x24,0x33,0x17,0x67,0xb2,0x31,0xf9,0x90,0x25,0x92,0x45,0xf0,
+  0x25,0xbc,0x46,0x19,0xf3,0x51,0xc7,0x1e,0x57,0xd4,0x75,0x5d,0x19,0xa2,0xb8,0xd9,
+  0x30,0x42,0x31,0xb4,0x8d,0xdd,0x11,0x3d,0x40,0x81,0xe6,0x8d,0x3a,0x78,0x5e,0x7e,
+  0xd6,0x59,0xd0,0x0d,0x74,0x64,0x75,0x81,0xd6,0x93,0xf7,0x3c,0xe1,0xa1,0x06,0x06,
+  0xb1,0x50,0xcb,0x15,0xc2,0x11,0x8c,0x42,0x19,0xf1,0x09,0xa9,0x3c,0xea,0x98,0x25,
+  0xb8,0x52,0xd5,0x76,0xd1,0x90,0xf2,0xc0,0x03,0x96,0x46,0xc8,0x4d,0x84,0x57,0xf0,
+  0xe9,0xb7,0xbf,0x1f,0x5a,0xf1,0xe9,0xb7,0x7f,0xf8,0xb7,0x75,0xb8,0xc3,0x89,0x7b,
+  0x77,0xc8,0xd4,0xf0,0x1a,0x37,0x12,0x19,0x32,0x2d,0x64,0xea,0xcf,0x15,0x8f,0xc7,
+  0x4e,0xc7,0x69,0x4c,0x3e,0xfd,0xf3,0x5f,0xf0,0x1c,0xb3,0x06,0xb4,0x84,0x1f,0xc5,
+  0x6b,0x01,0xef,0xb9,0x2e,0xb2,0x63,0x57,0x7d,0x06,0x2f,0xc4,0xeb,0x58,0xcc,0x90,
+  0xe3,0xdb,0x8c,0xa7,0xf0,0xc2,0x3c,0x7d,0x06,0x1b,0xc5,0xa7,0xd8,0x15,0x5d,0xaf,
+  0x01,0x26,0xc9,0x28,0x12,0xfb,0x3a,0x65,0xbd,0x5e,0x63,0xf2,0xce,0x50,0xdc,0x0a,
+  0xde,0x9d,0x61,0xb0,0x00,0x51,0x45,0xa2,0x7c,0xac,0xc7,0xac,0x5a,0x96,0x8b,0xdd,
+  0x57,0x1e,0x2a,0x91,0xe9,0xc9,0x89,0x1b,0x17,0x69,0x48,0x76,0xb9,0xde,0x06,0xa9,
+  0xd0,0xaa,0x5c,0x43,0xbc,0xc2,0x9b,0x63,0x88,0x64,0x58,0x2c,0xb1,0x96,0xfc,0x19,
+  0xd7,0xaf,0x12,0x4e,0xcb,0xe7,0xeb,0x37,0x91,0xeb,0xc4,0x2b,0xc7,0x1b,0x56,0xd4,
+  0x88,0x68,0x0f,0x52,0xcf,0x64,0x9d,0xda,0xa4,0xd7,0x43,0xbc,0xf1,0xbc,0x4e,0x8f,
+  0xd9,0xf5,0x20,0x77,0x3c,0xaf,0x93,0x5b,0x17,0x3c,0x74,0xc1,0x52,0xd0,0x1d,0xbc,
+  0xb4,0xb3,0x1e,0xb0,0x73,0xbe,0x46,0xc9,0x6e,0xd6,0x42,0x67,0xe6,0xc6,0x17,0x60,
+  0x74,0xf5,0x4d,0x9c,0x7c,0x03,0x76,0xc8,0xd6,0xfd,0x8e,0xe9,0xb9,0x8f,0x8d,0xd4,
+  0x0d,0x5a,0x76,0x29,0x52,0x17,0xe1,0xb0,0x95,0x79,0xde,0xc7,0xc0,0x83,0xc7,0xe0,
+  0x7c,0xe1,0x0c,0xf7,0xb7,0x4d,0x64,0xbe,0xc7,0xf1,0x0b,0xef,0x1a,0xdb,0xc0,0x41,
+  0x1a,0x17,0x65,0x7c,0xfc,0xe8,0x14,0x99,0x55,0x7d,0x5b,0xd7,0x24,0x5e,0xea,0x77,
+  0x88,0x1a,0xee,0xa2,0x54,0x42,0x61,0x82,0xaa,0x14,0xdc,0x85,0x3f,0x5d,0x6b,0x9e,
+  0x77,0xba,0x41,0xef,0xcc,0xf3,0xb5,0x7c,0x2d,0x6e,0x78,0xe4,0x5a,0x91,0xf0,0xe7,
+  0xe7,0xd8,0x12,0x2d,0xeb,0x05,0xa2,0x1c,0x12,0x05,0xc1,0x9e,0xa8,0x6b,0x89,0x72,
+  0x70,0x91,0xa2,0xca,0x4d,0xfc,0x43,0xe2,0xe7,0xd9,0xbd,0x2c,0x3b,0xb9,0xe7,0xdc,
+  0x52,0x6f,0x97,0xc0,0xa5,0x87,0xb8,0x0e,0xe7,0xae,0xd3,0xb1,0xbb,0x4e,0x6b,0x83,
+  0xe3,0xe6,0x5c,0x46,0x03,0xe7,0xe2,0xed,0xfb,0x4b,0x67,0xeb,0xf9,0x58,0x34,0x48,
+  0xe0,0x7a,0xe3,0x49,0xe0,0x59,0xb7,0xa0,0xa7,0x2f,0xc5,0x92,0xcb,0x42,0x9b,0xed,
+  0xaa,0xae,0x14,0xa7,0xb2,0x77,0xbd,0x16,0xf4,0xfa,0x41,0x70,0xdb,0x2f,0x19,0x36,
+  0xef,0x0f,0xa9,0x16,0xc9,0x87,0xcc,0xcd,0xd0,0xf3,0x18,0xa8,0x69,0xa9,0x45,0xc2,
+  0x35,0x68,0x25,0x38,0xc5,0x3d,0xb0,0x52,0x6c,0x36,0x68,0xdc,0x40,0x79,0x6f,0xa8,
+  0xa3,0x5e,0xb3,0xc4,0x08,0xdc,0x94,0x0e,0xb0,0xaa,0x5b,0x4e,0x9b,0x90,0x85,0x73,
+  0x3e,0x70,0x52,0xd9,0xce,0xb5,0x54,0x9c,0x34,0xd7,0x73,0x9e,0xba,0x0a,0xe9,0x41,
+  0xc4,0xe0,0x2a,0xec,0x70,0x1e,0x6c,0x30,0x39,0xb0,0xcb,0x54,0xfc,0xb4,0x37,0x44,
+  0x2d,0x5c,0xad,0x0a,0x8e,0xab,0x2d,0x6c,0xbd,0x92,0x79,0xcd,0xee,0xcd,0xb6,0x34,
+  0x1c,0x0c,0xa3,0xc7,0x8f,0xad,0xa6,0x13,0xe8,0x9e,0x07,0xf7,0x72,0x8c,0x59,0x92,
+  0x1b,0x96,0xe6,0xe6,0xb6,0x05,0x26,0xa0,0xd6,0x27,0x34,0x5c,0xe8,0xd4,0x2f,0x21,
+  0x05,0x2d,0x3c,0x2c,0xe1,0xaa,0xd0,0xe8,0x64,0x45,0x6d,0x1b,0xa5,0x7d,0xf9,0x65,
+  0xb5,0xfe,0x39,0xf8,0xc5,0xea,0x23,0x62,0xf7,0x51,0xec,0x6d,0xa8,0xc2,0x7c,0xcd,
+  0x6f,0xf4,0x0b,0x3b,0x81,0x52,0xa2,0x5e,0xa0,0x4e,0x39,0x47,0xd7,0x1d,0x83,0x3a,
+  0x71,0xa0,0xa7,0x5c,0xfb,0xce,0xb0,0x4c,0xcd,0xa1,0xd5,0x09,0xee,0x62,0x64,0xb1,
+  0x1c,0x23,0xe7,0xfb,0x7e,0x59,0x16,0xb6,0xfe,0x8e,0x09,0x9d,0x2a,0x39,0x4c,0x19,
+  0x06,0x2d,0x28,0xab,0xa3,0x66,0xd1,0xcd,0x5c,0x21,0x69,0xca,0x57,0xf0,0xd7,0xef,
+  0xfe,0xf2,0xad,0xd6,0xd9,0x3b,0xfe,0xb7,0x82,0xe7,0x98,0x8c,0xf6,0x32,0x9e,0xfb,
+  0x12,0xd1,0xd8,0xb5,0xd9,0x87,0x2c,0x3a,0x52,0xb3,0x6f,0xa8,0xb9,0x8f,0xa9,0x34,
+  0x62,0x9f,0x96,0x2d,0xb0,0xe1,0xaa,0xae,0x28,0x9e,0x67,0xc8,0x9f,0x5f,0x62,0xdb,
+  0x25,0x55,0x48,0x33,0xa7,0x14,0xdc,0xe9,0x40,0xd9,0x8e,0x32,0x25,0x67,0x48,0x99,
+  0x43,0x3e,0x97,0xab,0x1c,0x0a,0xca,0x44,0xc0,0x1c,0x01,0xfb,0xf2,0x84,0xbe,0xa0,
+  0x97,0xa4,0x1c,0x56,0x73,0x86,0x9d,0x5c,0xc3,0x9c,0xe1,0x5a,0x09,0x8d,0x06,0xfa,
+  0x55,0x92,0xc6,0xd4,0xd1,0x2e,0x42,0x94,0xd2,0xee,0xee,0x15,0x28,0x8c,0x04,0x0c,
+  0x68,0x25,0xa3,0x16,0x53,0x7e,0xed,0x6d,0x6a,0xe9,0xc3,0xaf,0xfd,0x84,0xa7,0x33,
+  0x3d,0x7f,0x21,0x97,0x38,0x33,0xb0,0x29,0xc6,0x83,0x82,0x5b,0x32,0x1e,0x01,0xe5,
+  0x54,0x55,0xe2,0xd6,0x6f,0x19,0x09,0xc4,0x8b,0x1a,0xbd,0x91,0xc0,0x37,0x96,0x09,
+  0x4a,0xe4,0x11,0x7c,0x45,0x89,0x05,0x9d,0xea,0xd4,0x83,0xc1,0xae,0x82,0xea,0xe1,
+  0xc8,0xc2,0x2a,0x1e,0xf6,0xa0,0xcc,0xcb,0x7a,0xad,0x65,0xd2,0x00,0xfb,0xc3,0xe5,
+  0x66,0x22,0xd2,0x29,0x21,0xf8,0xe1,0xba,0x53,0xfe,0x22,0xa7,0x9c,0x2e,0x77,0x16,
+  0x7b,0x56,0xd6,0x13,0x0b,0x33,0x1e,0x73,0x78,0x34,0xc6,0x98,0x29,0x1e,0x72,0x71,
+  0x8d,0x79,0xe6,0x90,0x37,0x0e,0x8e,0x70,0x94,0xc5,0xf7,0x2b,0x3a,0xf2,0x76,0x09,
+  0x5b,0xf1,0xd9,0xc7,0x63,0xe1,0x67,0xa1,0xbe,0x6d,0xb8,0xd9,0x3e,0xb2,0xfd,0xae,
+  0x44,0xaf,0xb4,0x19,0x1f,0x8a,0x44,0x6f,0x3b,0x3f,0xec,0x9e,0xb0,0x06,0x10,0x57,
+  0x07,0xe0,0xfc,0x88,0x79,0xb1,0x7b,0x26,0xb0,0x35,0x52,0xea,0xad,0xe3,0xde,0x3a,
+  0xd9,0x37,0x87,0x2a,0x12,0xde,0x5d,0x58,0x83,0x88,0xf1,0xc4,0x00,0xc6,0xbe,0x30,
+  0x52,0x1c,0x98,0xa5,0xba,0x03,0x2e,0xe0,0x08,0x82,0x28,0x90,0x15,0xfb,0x9d,0x23,
+  0xa8,0xc5,0x81,0x83,0x2c,0xf6,0x7e,0xb8,0xb7,0xdc,0x21,0x66,0x08,0x13,0x11,0xb8,
+  0x29,0xd7,0x2b,0xa9,0xae,0xc0,0x48,0xf6,0x76,0x00,0xb0,0x2d,0xb5,0xda,0x77,0x3c,
+  0x43,0xee,0x12,0xaf,0x4a,0xa5,0x3f,0x26,0xd7,0x4c,0x8a,0x25,0x1f,0xbf,0xf2,0xe1,
+  0x9d,0x1e,0xa4,0xa7,0x52,0x8f,0x23,0x2d,0x88,0x07,0xaa,0xb1,0xb8,0x47,0x07,0x79,
+  0xf5,0xfb,0x2a,0xa0,0xd1,0x34,0xca,0x9a,0xf8,0x0b,0x54,0x05,0xec,0x30,0x87,0xb1,
+  0x2e,0x61,0x62,0x0f,0x83,0xbf,0x1b,0x60,0xd3,0x84,0xff,0xf3,0x6f,0x58,0x31,0x93,
+  0x2c,0x10,0x63,0xf0,0x4a,0xac,0xc1,0xd9,0x35,0x94,0x38,0x52,0xd0,0xec,0x88,0xa3,
+  0x25,0xbd,0xfa,0xd4,0x19,0xff,0x0f,0x4d,0x19,0x0e,0xda,0xab,0xd3,0xa1,0x27,0xac,
+  0xcf,0x2a,0x55,0x8a,0xcc,0xdb,0x3c,0x9c,0x99,0x45,0x46,0xb9,0xfe,0xd2,0x2a,0x28,
+  0xf2,0x03,0xdd,0xe0,0x27,0x59,0xc0,0x92,0xad,0x41,0xee,0x67,0x65,0x1f,0x2b,0xa1,
+  0x3e,0x8a,0xdc,0xf3,0xb7,0xe3,0x18,0xe1,0xeb,0x6a,0x2a,0x35,0x58,0xb0,0x8e,0x68,
+  0xda,0xd1,0x38,0x45,0xf8,0x70,0x21,0x57,0xf8,0xf6,0x1a,0xae,0x31,0x87,0x09,0x16,
+  0x52,0xce,0xa3,0x7a,0x0e,0x54,0x05,0xb1,0x83,0xf3,0x4b,0x84,0x6c,0x0c,0x15,0x8e,
+  0xad,0x38,0x79,0x5c,0xe5,0x40,0x5d,0x2d,0xd7,0x34,0x98,0x4d,0x39,0xb9,0xb9,0xc4,
+  0xec,0xce,0x2e,0x86,0x08,0xe8,0xa8,0x33,0x01,0xbd,0x85,0x69,0xe0,0x69,0x94,0xfb,
+  0x87,0xa9,0x43,0x21,0xfa,0xa1,0xa4,0xdf,0x57,0xd5,0xff,0x0d,0xf1,0x0c,0xc6,0x44,
+  0x58,0xd0,0x08,0x1e,0xfb,0xac,0xdd,0x23,0x07,0xc7,0xd9,0xe1,0xf6,0x05,0x5b,0x1d,
+  0x74,0xc5,0x96,0xdb,0x82,0xde,0xa0,0xe1,0xe3,0x47,0x02,0x37,0x7a,0x4d,0x85,0x1d,
+  0xc1,0x11,0xa3,0xcd,0xdd,0x60,0x58,0x9f,0xe3,0xea,0xf6,0xb7,0xe0,0x8c,0x80,0xa7,
+  0x74,0xf8,0x11,0x3e,0xdd,0x7b,0xe7,0x1c,0xef,0x54,0x91,0xaa,0x61,0x96,0xf1,0xf8,
+  0x1f,0x84,0x2c,0x6a,0xb4,0x92,0xe6,0x22,0x62,0x61,0x1d,0x3f,0x19,0xf7,0xb0,0xcd,
+  0x61,0x67,0xd8,0x6f,0x8d,0x4e,0xa9,0xaa,0xc9,0x05,0xfb,0xe9,0x03,0x70,0x34,0x58,
+  0xd3,0x48,0x66,0x1a,0xda,0x02,0x4f,0xfe,0xf4,0xfe,0xed,0xf7,0x7e,0x46,0xbf,0xa9,
+  0xba,0x07,0xa3,0x02,0xa6,0x3e,0xce,0xef,0x9b,0x2d,0x39,0xc2,0xc8,0xc2,0x0f,0x64,
+  0xff,0xe8,0xd1,0x02,0xe7,0xc4,0x61,0xc9,0x16,0x1d,0x86,0xb1,0xb7,0x0d,0x09,0x17,
+  0xe4,0x6f,0x8f,0x1c,0xbe,0xf7,0xbc,0x43,0x43,0xa3,0x75,0x0f,0xf7,0x36,0xdb,0x5a,
+  0x9f,0x37,0xd3,0xe6,0x03,0x0d,0xe7,0xa0,0xab,0xd4,0xba,0xc6,0x61,0x2a,0x56,0x55,
+  0x50,0x86,0x72,0xdf,0xf8,0x6c,0x0e,0x94,0x7a,0x1c,0x9b,0x46,0x7b,0xae,0xf3,0xed,
+  0xe5,0xe5,0x05,0x38,0x8f,0xf7,0x2e,0xf3,0x6e,0xb7,0xff,0xfa,0xbc,0x29,0xd5,0xb2,
+  0x1c,0xcf,0x5e,0xe3,0xf2,0x25,0xd3,0x6c,0xa7,0x00,0x1d,0xf9,0x2c,0xc3,0xe2,0x37,
+  0x2f,0x78,0x76,0x96,0x24,0x78,0xc1,0x7f,0x9f,0x7e,0x9b,0xae,0x4d,0x63,0x39,0x11,
+  0xd1,0x05,0x3b,0xed,0x1a,0x11,0x2b,0x91,0x46,0x72,0xe5,0x5b,0x3c,0x43,0x19,0x76,
+  0x31,0x3c,0xd9,0x7a,0x24,0x61,0xd4,0xd9,0xbd,0xcc,0xe2,0x4b,0x33,0xfd,0x54,0x33,
+  0xea,0x98,0xdf,0xc5,0x4f,0xfe,0x0b,0x64,0xcd,0x6d,0x7b,0x2e,0x17,0x00,0x00,
+};
@@ -4,14 +4,49 @@
 #include <Preferences.h>
 #include <DNSServer.h>
 #include "led_stat.h"
+#include "RGBstats.h"
 #include <vector>
 #include <algorithm>
 #include "esp_wifi.h"
 #include <Update.h>  // OTA
+#include "web_ota.h"  // OTA page, gzip'd (tools/webgz.py)
 
 // Single global server used by the whole project
 static AsyncWebServer server(80);
 
+// OTA writer: one flash sector per Update.write(), a small pool of them
+// between the upload callback and the writer task.
+#ifndef WIFIMGR_OTA_BLOCK
+#define WIFIMGR_OTA_BLOCK 4096
+#endif
+#ifndef WIFIMGR_OTA_BLOCKS
+#define WIFIMGR_OTA_BLOCKS 4
+#endif
+#ifndef WIFIMGR_OTA_PRIO
+#define WIFIMGR_OTA_PRIO 2          // above loop() (1), below async_tcp (3)
+#endif
+// Connection profile: STA down this long before the fallback AP comes back;
+// after STA connects, the AP lingers this long while a phone is still on it
+// (so the portal can show the new IP) before it is dropped.
+#ifndef WIFIMGR_FALLBACK_MS
+#define WIFIMGR_FALLBACK_MS 15000
+#endif
+#ifndef WIFIMGR_AP_LINGER_MS
+#define WIFIMGR_AP_LINGER_MS 60000
+#endif
+#ifndef WIFIMGR_OTA_IDLE_MS
+#define WIFIMGR_OTA_IDLE_MS 20000   // give up on an upload that stops sending
+#endif
+
+// Pending LED config writes must land before we restart; the ring shows
+// OTA progress instead of the animation.
+namespace RGBCtrl {
+  void flushSave();
+  void otaBegin();
+  void otaProgress(uint16_t permille);
+  void otaEnd(bool ok);
+}
+
 namespace WiFiMgr {
 
 static String ssid, password;
@@ -27,6 +62,21 @@ static const int maxAttempts = 10;
 static unsigned long lastAttempt = 0;
 static unsigned long retryDelay = 3000;
 
+// ===== Connection profile =====
+// apOff: drop the setup AP and captive DNS once STA is up, so the radio stops
+// time-slicing between two interfaces. apFallback: bring the AP back if STA
+// stays down for WIFIMGR_FALLBACK_MS. ps: modem power save (none = lowest
+// UDP latency/jitter for streaming; min = the ESP32 default; max = idle).
+// Defaults keep the old behaviour (AP always on, min modem).
+enum : uint8_t { PS_NONE = 0, PS_MIN = 1, PS_MAX = 2 };
+static const char* const PS_NAMES[] = { "none", "min", "max" };
+struct Profile { bool apOff = false; bool apFallback = true; uint8_t ps = PS_MIN; };
+static Profile profile;
+static bool apUp = false;
+static unsigned long connectedMs = 0;   // STA came up
+static unsigned long staLostMs   = 0;   // STA dropped while CONNECTED, 0 = up
+static uint32_t statStaLost = 0, statFallbacks = 0, statApDrops = 0;
+
 // Ensure portal routes are only added once (so we don't need server.reset()).
 static bool portalRoutesAdded = false;
 
@@ -34,6 +84,23 @@ AsyncWebServer& getServer() {
   return server;
 }
 
+// Serve a gzip'd page straight from flash. The browser keeps it and
+// revalidates with If-None-Match, so repeat loads cost a 304 and no heap.
+void sendGzPage(AsyncWebServerRequest* req, const uint8_t* gz, size_t len, const String& etag) {
+  const String tag = "\"" + etag + "\"";
+  if (req->hasHeader("If-None-Match") && req->getHeader("If-None-Match")->value() == tag) {
+    AsyncWebServerResponse* resp = req->beginResponse(304, "text/html", "");
+    resp->addHeader("ETag", tag);
+    req->send(resp);
+    return;
+  }
+  AsyncWebServerResponse* resp = req->beginResponse_P(200, "text/html", gz, len);
+  resp->addHeader("Content-Encoding", "gzip");
+  resp->addHeader("ETag", tag);
+  resp->addHeader("Cache-Control", "no-cache");   // cache, but always revalidate
+  req->send(resp);
+}
+
 // ---------------- WiFi cred storage ----------------
 static void loadCreds() {
   prefs.begin("wifi", true);
@@ -56,6 +123,29 @@ static void clearCreds() {
   prefs.end();
 }
 
+static void loadProfile() {
+  prefs.begin("wifi", true);
+  profile.apOff      = prefs.getBool("apOff", false);
+  profile.apFallback = prefs.getBool("apFb", true);
+  profile.ps         = prefs.getUChar("ps", PS_MIN);
+  prefs.end();
+  if (profile.ps > PS_MAX) profile.ps = PS_MIN;
+}
+
+static void saveProfile() {
+  prefs.begin("wifi", false);
+  prefs.putBool("apOff", profile.apOff);
+  prefs.putBool("apFb", profile.apFallback);
+  prefs.putUChar("ps", profile.ps);
+  prefs.end();
+}
+
+// Re-applied after every mode change (the driver resets it).
+static void applyPowerSave() {
+  static const wifi_ps_type_t PS[] = { WIFI_PS_NONE, WIFI_PS_MIN_MODEM, WIFI_PS_MAX_MODEM };
+  esp_wifi_set_ps(PS[profile.ps]);
+}
+
 // --------------- AP/Portal helpers -----------------
 static void setAPConfig() {
   WiFi.softAPConfig(
@@ -65,125 +155,227 @@ static void setAPConfig() {
   );
 }
 
-// ===== OTA HTML (progress + client-driven reboot) =====
-static const char OTA_PAGE[] PROGMEM = R"html(
-<!DOCTYPE html><html><head><meta charset="utf-8">
-<meta name="viewport" content="width=device-width,initial-scale=1,viewport-fit=cover">
-<title>OTA Update</title>
-<style>
-  :root{--bg:#111;--card:#222;--ink:#EEE;--mut:#AAB;--btn:#2563eb;--ok:#2ea043;--err:#d32}
-  *{box-sizing:border-box} html,body{height:100%}
-  body{background:var(--bg);color:var(--ink);font-family:system-ui,Segoe UI,Roboto,Arial;margin:0}
-  .wrap{min-height:100%;display:flex;align-items:center;justify-content:center;padding:env(safe-area-inset-top) 12px env(safe-area-inset-bottom)}
-  .box{width:100%;max-width:520px;margin:16px auto;background:var(--card);padding:18px 16px;border-radius:12px;box-shadow:0 8px 20px #0008}
-  h2{margin:0 0 12px}
-  .row{display:grid;grid-template-columns:1fr;gap:10px}
-  input[type=file],button{width:100%;margin:.25rem 0;padding:.7rem .8rem;border-radius:9px;border:1px solid #555;background:#111;color:var(--ink);font-size:1rem}
-  button{background:var(--btn);border:0;color:#fff;cursor:pointer}
-  .status{margin-top:10px;color:var(--mut)}
-  .bar{height:12px;background:#0c1222;border:1px solid #334;border-radius:999px;overflow:hidden}
-  .fill{height:100%;width:0%}
-  .ok{background:linear-gradient(90deg,#28a745,#3ddc84)}
-  .up{background:linear-gradient(90deg,#4c7cff,#7aa4ff)}
-  .err{background:linear-gradient(90deg,#d32,#f55)}
-  .msg{margin-top:8px;font-size:.95rem}
-</style></head>
-<body>
-<div class="wrap">
-  <div class="box">
-    <h2>OTA Update</h2>
-    <div class="row">
-      <input id="fw" type="file" accept=".bin,.bin.gz">
-      <button id="go">Upload & Flash</button>
-      <div class="bar"><div id="fill" class="fill up"></div></div>
-      <div id="msg" class="msg">Select a firmware <code>.bin</code> (or <code>.bin.gz</code>) and click “Upload & Flash”.</div>
-      <div class="row">
-        <button onclick="location.href='/'">⟵ Back to WiFi Setup</button>
-        <button onclick="location.href='/config'">Open Config</button>
-        <button onclick="reboot()" style="background:#a22">Reboot</button>
-      </div>
-      <div id="status" class="status"></div>
-    </div>
-  </div>
-</div>
-<script>
-(function(){
-  const fw   = document.getElementById('fw');
-  const btn  = document.getElementById('go');
-  const fill = document.getElementById('fill');
-  const msg  = document.getElementById('msg');
-  const status = document.getElementById('status');
-
-  function setFill(p, cls){
-    fill.style.width = (Math.max(0,Math.min(100,p))|0) + '%';
-    fill.className = 'fill ' + (cls||'up');
+// ===== OTA pipeline =====
+// The upload callback runs on the async_tcp task. Writing flash from there
+// stalls every other request for each sector erase, so chunks are copied
+// into sector-sized blocks and queued to a writer task instead. When the
+// pool is empty the callback waits for a block, which holds back TCP
+// rather than dropping data. Update.end(true) verifies the image (and the
+// MD5, if the client passed ?md5=) before the writer reports done.
+enum class OtaState : uint8_t { IDLE, RECEIVING, VERIFYING, DONE, FAILED };
+static const char* const OTA_STATE_NAMES[] = { "idle", "receiving", "verifying", "done", "failed" };
+
+struct OtaBlock { uint16_t len; uint8_t data[WIFIMGR_OTA_BLOCK]; };
+static const uint8_t OTA_NONE = 0xFF;        // no block held
+static const uint8_t OTA_MSG_END   = 0xFE;   // queue markers after the block indices
+static const uint8_t OTA_MSG_ABORT = 0xFD;
+
+static OtaBlock*     otaPool = nullptr;      // kept once allocated
+static QueueHandle_t otaFull = nullptr;      // filled blocks / markers -> writer
+static QueueHandle_t otaFree = nullptr;      // empty blocks -> receiver
+static volatile OtaState otaState = OtaState::IDLE;
+static const char* volatile otaErr = nullptr;
+static volatile uint32_t otaRx = 0, otaWritten = 0, otaTotal = 0;
+static volatile uint32_t otaStartMs = 0, otaEndMs = 0;
+static volatile uint32_t otaStalls = 0, otaQPeak = 0;
+static volatile bool     otaRebootPending = false;
+
+// Receiver side (async_tcp task only)
+static AsyncWebServerRequest* otaReq = nullptr;
+static uint8_t otaCur = OTA_NONE;
+static bool    otaFinalSent = false;
+
+static bool otaBusy() {
+  return otaState == OtaState::RECEIVING || otaState == OtaState::VERIFYING;
+}
+
+static void rebootNow() {
+  RGBCtrl::flushSave();
+  auto t = millis() + 300; while (millis() < t) { delay(1); }
+  ESP.restart();
+}
+
+static void otaWriterMain(void*) {
+  bool ok = true;
+  uint8_t m = OTA_MSG_ABORT;
+  for (;;) {
+    if (xQueueReceive(otaFull, &m, pdMS_TO_TICKS(WIFIMGR_OTA_IDLE_MS)) != pdTRUE) {
+      if (!otaErr) otaErr = "upload stalled";
+      m = OTA_MSG_ABORT;
+    }
+    if (m == OTA_MSG_END || m == OTA_MSG_ABORT) break;
+
+    OtaBlock& b = otaPool[m];
+    if (ok && Update.write(b.data, b.len) != b.len) {
+      ok = false;
+      if (!otaErr) otaErr = Update.errorString();
+    }
+    if (ok) {
+      otaWritten += b.len;
+      if (otaTotal) RGBCtrl::otaProgress((uint16_t)(((uint64_t)otaWritten * 1000) / otaTotal));
+    }
+    xQueueSend(otaFree, &m, 0);
   }
-  function reboot(){
-    fetch('/reboot',{method:'POST'}).catch(()=>0);
-    setTimeout(()=>location.reload(), 2500);
+
+  if (ok && m == OTA_MSG_END) {
+    otaState = OtaState::VERIFYING;
+    RGBCtrl::otaProgress(1000);
+    if (!Update.end(true)) { ok = false; if (!otaErr) otaErr = Update.errorString(); }
+  } else {
+    ok = false;
+    Update.abort();
   }
-  function pingUntilUp(path, cb){
-    let tries = 0;
-    const t = setInterval(()=>{
-      fetch(path, {cache:'no-store'}).then(r=>{ if (r.ok) { clearInterval(t); cb(true); } })
-      .catch(()=>{});
-      if (++tries > 180) { clearInterval(t); cb(false); }
-    }, 1000);
+  otaEndMs = millis();
+  otaState = ok ? OtaState::DONE : OtaState::FAILED;
+  RGBCtrl::otaEnd(ok);
+
+  const uint32_t ms = otaEndMs - otaStartMs;
+  if (ok) Serial.printf("[OTA] Verified: %u bytes in %u ms (%u B/s, %u stalls)\n",
+                        (unsigned)otaWritten, (unsigned)ms,
+                        (unsigned)(ms ? (uint64_t)otaWritten * 1000 / ms : 0), (unsigned)otaStalls);
+  else    Serial.printf("[OTA] Failed after %u bytes: %s\n", (unsigned)otaWritten, otaErr ? otaErr : "?");
+
+  if (ok && otaRebootPending) rebootNow();
+  otaRebootPending = false;
+  vTaskDelete(nullptr);
+}
+
+static void otaFailStart(const char* why) {
+  otaErr = why;
+  otaEndMs = millis();
+  otaState = OtaState::FAILED;
+  RGBCtrl::otaEnd(false);
+  Serial.printf("[OTA] Not started: %s\n", why);
+}
+
+static bool otaStart(AsyncWebServerRequest* req, const String& filename) {
+  if (otaBusy()) return false;                  // that request gets a 409
+  otaReq = req;
+  otaCur = OTA_NONE;
+  otaFinalSent = false;
+  otaErr = nullptr;
+  otaRx = otaWritten = otaStalls = otaQPeak = 0;
+  otaStartMs = millis();
+  otaRebootPending = false;
+
+  if (!otaPool) otaPool = (OtaBlock*)malloc(sizeof(OtaBlock) * WIFIMGR_OTA_BLOCKS);
+  if (!otaFull) otaFull = xQueueCreate(WIFIMGR_OTA_BLOCKS + 2, sizeof(uint8_t));
+  if (!otaFree) otaFree = xQueueCreate(WIFIMGR_OTA_BLOCKS, sizeof(uint8_t));
+  if (!otaPool || !otaFull || !otaFree) { otaFailStart("no memory"); return false; }
+  xQueueReset(otaFull);
+  xQueueReset(otaFree);
+  for (uint8_t i=0; i<WIFIMGR_OTA_BLOCKS; ++i) xQueueSend(otaFree, &i, 0);
+
+  // ?size= (exact image size) lets Update reject an oversize image up front;
+  // otherwise the multipart length is close enough for progress.
+  const uint32_t size = req->hasParam("size") ? (uint32_t)req->getParam("size")->value().toInt() : 0;
+  otaTotal = size ? size : (uint32_t)req->contentLength();
+
+  Serial.printf("[OTA] Starting: %s (%u bytes)\n", filename.c_str(), (unsigned)otaTotal);
+  if (!Update.begin(size ? size : UPDATE_SIZE_UNKNOWN)) { otaFailStart(Update.errorString()); return false; }
+  if (req->hasParam("md5") && !Update.setMD5(req->getParam("md5")->value().c_str())) {
+    Update.abort(); otaFailStart("bad md5"); return false;
   }
 
-  btn.onclick = function(){
-    const f = fw.files && fw.files[0];
-    if(!f){ msg.textContent = 'Please select a firmware file first.'; return; }
+  otaState = OtaState::RECEIVING;
+  if (xTaskCreate(otaWriterMain, "ota", 4096, nullptr, WIFIMGR_OTA_PRIO, nullptr) != pdPASS) {
+    Update.abort(); otaFailStart("no task"); return false;
+  }
+  RGBCtrl::otaBegin();
+
+  req->onDisconnect([req](){
+    if (req != otaReq) return;
+    otaReq = nullptr;
+    if (!otaFinalSent && otaState == OtaState::RECEIVING) {
+      if (!otaErr) otaErr = "client disconnected";
+      const uint8_t m = OTA_MSG_ABORT;
+      xQueueSend(otaFull, &m, 0);
+    }
+  });
+  return true;
+}
 
-    msg.textContent = 'Uploading...';
-    status.textContent = '';
-    setFill(0, 'up');
+// Hand the current block to the writer.
+static void otaPush() {
+  xQueueSend(otaFull, &otaCur, 0);              // sized for every block + a marker
+  otaCur = OTA_NONE;
+  const uint32_t q = uxQueueMessagesWaiting(otaFull);
+  if (q > otaQPeak) otaQPeak = q;
+}
 
-    const xhr = new XMLHttpRequest();
-    xhr.open('POST', '/ota', true);
-    xhr.responseType = 'text';
+static bool otaTakeBlock() {
+  if (xQueueReceive(otaFree, &otaCur, 0) != pdTRUE) {
+    ++otaStalls;                                // writer behind: hold back TCP
+    if (xQueueReceive(otaFree, &otaCur, pdMS_TO_TICKS(2000)) != pdTRUE) {
+      otaCur = OTA_NONE;
+      if (!otaErr) otaErr = "flash write stalled";
+      const uint8_t m = OTA_MSG_ABORT;
+      xQueueSend(otaFull, &m, 0);
+      otaReq = nullptr;                         // ignore the rest of this upload
+      return false;
+    }
+  }
+  otaPool[otaCur].len = 0;
+  return true;
+}
 
-    xhr.upload.onprogress = function(ev){
-      if (ev.lengthComputable) {
-        const pc = ev.total ? (ev.loaded * 100 / ev.total) : 0;
-        setFill(pc, 'up');
-      }
-    };
-
-    xhr.onerror = function(){
-      setFill(100, 'err');
-      msg.textContent = 'Upload failed (network error).';
-    };
-
-    xhr.onload = function(){
-      let ok = xhr.status>=200 && xhr.status<300;
-      try { const j = JSON.parse(xhr.responseText||'{}'); ok = ok && !!j.ok; } catch(e){}
-      if (ok) {
-        setFill(100, 'ok');
-        msg.textContent = 'Flashed OK. Rebooting device...';
-        status.textContent = 'Waiting for device to come back online...';
-        fetch('/reboot',{method:'POST'}).catch(()=>0);
-        pingUntilUp('/ping', function(up){
-          status.textContent = up ? 'Device is back online. You may open Config.' :
-                                    'Device did not respond in time. Power-cycle if needed.';
-        });
-      } else {
-        setFill(100, 'err');
-        msg.textContent = 'Flash failed.';
-        status.textContent = xhr.responseText || ('HTTP '+xhr.status);
-      }
-    };
+static void otaUpload(AsyncWebServerRequest* req, const String& filename,
+                      size_t index, uint8_t* data, size_t len, bool final) {
+  if (index == 0 && !otaStart(req, filename)) return;
+  if (req != otaReq || otaState != OtaState::RECEIVING) return;
+
+  while (len) {
+    if (otaCur == OTA_NONE && !otaTakeBlock()) return;
+    OtaBlock& b = otaPool[otaCur];
+    size_t n = WIFIMGR_OTA_BLOCK - b.len;
+    if (n > len) n = len;
+    memcpy(b.data + b.len, data, n);
+    b.len += n; data += n; len -= n; otaRx += n;
+    if (b.len == WIFIMGR_OTA_BLOCK) otaPush();
+  }
+  if (final) {
+    if (otaCur != OTA_NONE) otaPush();
+    const uint8_t m = OTA_MSG_END;
+    xQueueSend(otaFull, &m, 0);
+    otaFinalSent = true;
+  }
+}
 
-    const form = new FormData();
-    form.append('firmware', f, f.name);
-    xhr.send(form);
-  };
+String otaStatusJson() {
+  const OtaState st = otaState;
+  const uint32_t now = (st == OtaState::DONE || st == OtaState::FAILED) ? otaEndMs : millis();
+  const uint32_t ms  = (st == OtaState::IDLE) ? 0 : now - otaStartMs;
+  const uint32_t wr = otaWritten, tot = otaTotal;
+  String out = "{\"state\":\"";
+  out += OTA_STATE_NAMES[(uint8_t)st];
+  out += "\",\"rx\":" + String(otaRx);
+  out += ",\"bytes\":" + String(wr);
+  out += ",\"total\":" + String(tot);
+  out += ",\"pct\":" + String(tot ? (uint32_t)(((uint64_t)wr * 100) / tot) : 0);
+  out += ",\"ms\":" + String(ms);
+  out += ",\"Bps\":" + String(ms ? (uint32_t)(((uint64_t)wr * 1000) / ms) : 0);
+  out += ",\"stalls\":" + String(otaStalls);
+  out += ",\"qpeak\":" + String(otaQPeak);
+  const char* e = otaErr;
+  if (e) { out += ",\"err\":\""; out += e; out += "\""; }
+  out += "}";
+  return out;
+}
 
-  window.reboot = reboot;
-})();
-</script>
-</body></html>
-)html";
+// A reboot mid-write would throw the update away: refuse while receiving,
+// and while verifying let the writer restart once the image checks out.
+static bool otaHoldReboot(AsyncWebServerRequest* req) {
+  if (otaState == OtaState::RECEIVING) {
+    req->send(409, "text/plain", "Update in progress");
+    return true;
+  }
+  if (otaState == OtaState::VERIFYING) {
+    otaRebootPending = true;
+    req->send(200, "text/plain", "Rebooting after verify...");
+    return true;
+  }
+  return false;
+}
 
 // ===== OTA route registration =====
 static void registerOTARoutes() {
@@ -195,58 +387,50 @@ static void registerOTARoutes() {
 
   // OTA page
   server.on("/ota", HTTP_GET, [](AsyncWebServerRequest* req){
-    req->send_P(200, "text/html", OTA_PAGE);
+    sendGzPage(req, OTA_HTML_GZ, OTA_HTML_GZ_LEN, OTA_HTML_ETAG);
   });
 
-  // OTA upload/flash (streamed), JSON reply; client triggers /reboot
+  // Progress / throughput of the current (or last) update
+  server.on("/ota/status", HTTP_GET, [](AsyncWebServerRequest* req){
+    AsyncWebServerResponse* resp = req->beginResponse(200, "application/json", otaStatusJson());
+    resp->addHeader("Cache-Control", "no-store");
+    req->send(resp);
+  });
+
+  // OTA upload (queued to the writer task), JSON reply. The last blocks may
+  // still be writing/verifying when this answers: poll /ota/status for
+  // "done" before calling /reboot (an early /reboot waits for the verify).
   server.on(
     "/ota",
     HTTP_POST,
     [](AsyncWebServerRequest* request){
-      const bool ok = !Update.hasError();
-      if (ok) {
-        String msg = "{\"ok\":true,\"bytes\":" + String(Update.progress()) + "}";
-        request->send(200, "application/json", msg);
-        Serial.println("[OTA] Update uploaded OK; client will reboot device.");
-      } else {
-        request->send(500, "application/json", "{\"ok\":false}");
-        Serial.println("[OTA] Update failed.");
+      if (request != otaReq) {
+        const bool busy = otaBusy();
+        request->send(busy ? 409 : 500, "application/json",
+                      busy ? "{\"ok\":false,\"err\":\"busy\"}" : "{\"ok\":false,\"ota\":" + otaStatusJson() + "}");
+        return;
       }
+      const bool ok = otaState != OtaState::FAILED;
+      String msg = "{\"ok\":";
+      msg += ok ? "true" : "false";
+      msg += ",\"bytes\":" + String(otaRx) + ",\"ota\":" + otaStatusJson() + "}";
+      request->send(ok ? 200 : 500, "application/json", msg);
     },
-    [](AsyncWebServerRequest* request, String filename, size_t index, uint8_t* data, size_t len, bool final){
-      if (index == 0) {
-        Serial.printf("[OTA] Starting: %s\n", filename.c_str());
-        if (!Update.begin(UPDATE_SIZE_UNKNOWN)) {
-          Update.printError(Serial);
-        }
-      }
-      if (len) {
-        if (Update.write(data, len) != len) {
-          Update.printError(Serial);
-        }
-      }
-      if (final) {
-        if (!Update.end(true)) {
-          Update.printError(Serial);
-        } else {
-          Serial.printf("[OTA] Finished: %u bytes\n", (unsigned)(index + len));
-        }
-      }
-    }
+    otaUpload
   );
 
   // Reboot endpoint (client calls this after success)
   server.on("/reboot", HTTP_POST, [](AsyncWebServerRequest* req){
+    if (otaHoldReboot(req)) return;
     req->send(200, "text/plain", "Rebooting...");
     Serial.println("[OTA] Reboot requested");
-    auto t = millis() + 300; while (millis() < t) { delay(1); }
-    ESP.restart();
+    rebootNow();
   });
   server.on("/reboot", HTTP_GET, [](AsyncWebServerRequest* req){
+    if (otaHoldReboot(req)) return;
     req->send(200, "text/plain", "Rebooting...");
     Serial.println("[OTA] Reboot requested (GET)");
-    auto t = millis() + 300; while (millis() < t) { delay(1); }
-    ESP.restart();
+    rebootNow();
   });
 }
 
@@ -291,6 +475,8 @@ static void addPortalRoutesOnce() {
     .status {margin-top:8px;opacity:.9;font-size:.95em}
     .links{display:flex;gap:8px;flex-wrap:wrap}
     .links a{color:var(--link);text-decoration:none}
+    .chk{display:flex;align-items:center;gap:.5em;color:var(--ink)}
+    .chk input{width:auto;margin:0}
   </style>
 </head>
 <body>
@@ -307,6 +493,14 @@ static void addPortalRoutesOnce() {
       <input type="password" id="pass" placeholder="WiFi Password">
       <button type="button" onclick="save()" class="btn-primary">Connect & Save</button>
       <button type="button" onclick="forget()" class="btn-danger">Forget WiFi</button>
+      <label>Connection profile</label>
+      <label class="chk"><input type="checkbox" id="apOff" onchange="prof()"> Turn off this setup hotspot once connected</label>
+      <label class="chk"><input type="checkbox" id="apFallback" onchange="prof()"> Bring the hotspot back if WiFi drops</label>
+      <select id="ps" onchange="prof()">
+        <option value="none">Power save: off (lowest latency, streaming)</option>
+        <option value="min">Power save: min modem (default)</option>
+        <option value="max">Power save: max modem (idle, lowest power)</option>
+      </select>
       <div class="links">
         <button type="button" onclick="window.location='/ota'" class="btn-ota">OTA Update</button>
         <button type="button" onclick="window.location='/config'" class="btn-config">Open Config</button>
@@ -341,7 +535,15 @@ static void addPortalRoutesOnce() {
     });
   }
   setInterval(scan, 3000);
-  window.onload = scan;
+  window.onload = function(){ scan(); prof(true); };
+
+  function prof(readOnly) {
+    let q = '';
+    if (!readOnly) q = '?apOff=' + (apOff.checked ? 1 : 0) + '&apFallback=' + (apFallback.checked ? 1 : 0) + '&ps=' + ps.value;
+    fetch('/wifi/profile' + q, {cache:'no-store'}).then(r => r.json()).then(p => {
+      apOff.checked = p.apOff; apFallback.checked = p.apFallback; ps.value = p.ps;
+    }).catch(() => {});
+  }
 
   function save() {
     let ssid = document.getElementById('ssid').value;
@@ -491,6 +693,23 @@ static void addPortalRoutesOnce() {
     request->send(resp);
   });
 
+  // ---------- Connection profile ----------
+  // GET /wifi/profile                 -> JSON (profile + live AP/STA state)
+  // GET /wifi/profile?apOff=1&apFallback=0&ps=none   sets (any subset), saved
+  server.on("/wifi/profile", HTTP_GET, [](AsyncWebServerRequest *request){
+    bool changed = false;
+    if (request->hasParam("apOff"))      { profile.apOff = request->getParam("apOff")->value() == "1"; changed = true; }
+    if (request->hasParam("apFallback")) { profile.apFallback = request->getParam("apFallback")->value() == "1"; changed = true; }
+    if (request->hasParam("ps")) {
+      const String v = request->getParam("ps")->value();
+      for (uint8_t i=0; i<=PS_MAX; ++i) if (v == PS_NAMES[i]) { profile.ps = i; changed = true; }
+    }
+    if (changed) { saveProfile(); applyPowerSave(); }   // AP policy follows in loop()
+    AsyncWebServerResponse* resp = request->beginResponse(200, "application/json", profileJson());
+    resp->addHeader("Cache-Control", "no-store");
+    request->send(resp);
+  });
+
   // ---------- Forget ----------
   server.on("/forget", HTTP_GET, [](AsyncWebServerRequest *request){
     clearCreds();
@@ -514,14 +733,12 @@ static void addPortalRoutesOnce() {
   server.on("/ncsi.txt", HTTP_GET, cp);
   server.on("/captiveportal", HTTP_GET, cp);
   server.onNotFound(cp);
-
-  // No caching for UI/API
-  DefaultHeaders::Instance().addHeader("Cache-Control", "no-store");
+  // Dynamic routes set no-store themselves; a global default would also
+  // stamp it on the cached static pages.
 }
 
-static void startPortal() {
-  WiFi.disconnect(true);
-  delay(100);
+// Soft-AP + captive DNS, next to whatever STA is doing.
+static void startAP() {
   setAPConfig();
   WiFi.mode(WIFI_AP_STA);  // AP+STA so scan works while in portal
   delay(100);
@@ -529,12 +746,31 @@ static void startPortal() {
   // Channel 6 for iOS compatibility
   bool apok = WiFi.softAP("XBOX RGB Setup", "", 6, 0);
   esp_wifi_set_max_tx_power(20);
-  LedStat::setStatus(LedStatus::Portal);
   Serial.printf("[WiFiMgr] softAP=%d, IP: %s\n", apok, WiFi.softAPIP().toString().c_str());
   delay(200);
 
   IPAddress apIP = WiFi.softAPIP();
   dnsServer.start(53, "*", apIP);
+  apUp = true;
+  applyPowerSave();
+}
+
+// STA only: the radio stays on the router's channel full time.
+static void stopAP() {
+  dnsServer.stop();
+  WiFi.softAPdisconnect(false);
+  WiFi.mode(WIFI_STA);
+  apUp = false;
+  applyPowerSave();
+  ++statApDrops;
+  Serial.println("[WiFiMgr] STA up: setup AP off");
+}
+
+static void startPortal() {
+  WiFi.disconnect(true);
+  delay(100);
+  startAP();
+  LedStat::setStatus(LedStatus::Portal);
 
   // Do NOT reset the server: keep previously-registered routes (like /config) live in AP mode.
   addPortalRoutesOnce();
@@ -563,10 +799,42 @@ static void tryConnect() {
   }
 }
 
+// CONNECTED: apply the profile's AP policy as STA comes and goes (the driver
+// reconnects STA by itself).
+static void serviceProfile() {
+  const unsigned long now = millis();
+  if (WiFi.status() == WL_CONNECTED) {
+    if (staLostMs) {
+      staLostMs = 0; connectedMs = now;
+      if (apUp) dnsServer.stop();          // fallback AP: no captive DNS once back
+      LedStat::setStatus(LedStatus::WifiConnected);
+    }
+    if (profile.apOff && apUp && !otaBusy() &&
+        (WiFi.softAPgetStationNum() == 0 || now - connectedMs >= WIFIMGR_AP_LINGER_MS))
+      stopAP();
+    else if (!profile.apOff && !apUp) {
+      startAP();                           // profile changed back: AP on again,
+      dnsServer.stop();                    // without captive DNS (STA is up)
+    }
+    return;
+  }
+  if (!staLostMs) {
+    staLostMs = now | 1;
+    ++statStaLost;
+    Serial.println("[WiFiMgr] STA lost");
+  } else if (profile.apFallback && !apUp && now - staLostMs >= WIFIMGR_FALLBACK_MS) {
+    ++statFallbacks;
+    Serial.println("[WiFiMgr] STA still down: fallback AP on");
+    startAP();
+    LedStat::setStatus(LedStatus::Portal);
+  }
+}
+
 // ---------------- Public API ----------------
 void begin() {
   LedStat::setStatus(LedStatus::Booting);
   loadCreds();
+  loadProfile();
   startPortal();    // always start captive portal
   if (ssid.length() > 0) {
     tryConnect();   // attempt STA connect in background
@@ -580,6 +848,9 @@ void loop() {
     if (WiFi.status() == WL_CONNECTED) {
       state = State::CONNECTED;
       dnsServer.stop();
+      connectedMs = millis(); staLostMs = 0;
+      RGBstats::bootMark(RGBstats::BOOT_STA);
+      applyPowerSave();
       Serial.println("[WiFiMgr] WiFi connected.");
       Serial.print("[WiFiMgr] IP Address: ");
       Serial.println(WiFi.localIP());
@@ -596,6 +867,8 @@ void loop() {
         lastAttempt = millis();
       }
     }
+  } else if (state == State::CONNECTED) {
+    serviceProfile();
   }
 }
 
@@ -612,6 +885,19 @@ bool isConnected() {
   return WiFi.status() == WL_CONNECTED;
 }
 
+String profileJson() {
+  char buf[256];
+  const bool sta = WiFi.status() == WL_CONNECTED;
+  snprintf(buf, sizeof(buf),
+           "{\"apOff\":%s,\"apFallback\":%s,\"ps\":\"%s\",\"ap\":%s,\"sta\":%s,"
+           "\"rssi\":%ld,\"ch\":%ld,\"staLost\":%lu,\"fallbacks\":%lu,\"apDrops\":%lu}",
+           profile.apOff ? "true" : "false", profile.apFallback ? "true" : "false",
+           PS_NAMES[profile.ps], apUp ? "true" : "false", sta ? "true" : "false",
+           (long)(sta ? WiFi.RSSI() : 0), (long)WiFi.channel(),
+           (unsigned long)statStaLost, (unsigned long)statFallbacks, (unsigned long)statApDrops);
+  return String(buf);
+}
+
 String getStatus() {
   if (isConnected()) return "Connected to: " + ssid;
   if (state == State::CONNECTING) return "Connecting to: " + ssid;
@@ -12,4 +12,9 @@ namespace WiFiMgr {
     void forgetWiFi();
     bool isConnected();
     String getStatus();
+    // Connection profile (AP-off-after-connect, AP fallback, power save)
+    // plus live AP/STA state, RSSI and channel, as JSON.
+    String profileJson();
+    // Current/last OTA update: state, bytes written, total, ms, B/s, stalls.
+    String otaStatusJson();
 }
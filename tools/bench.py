@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""
+Run the firmware's render benchmark and compare it with a golden set, either
+on a device over UDP or on the host build in tools/hostbench.
+
+    python tools/bench.py 192.168.1.50                 # run, compare, print
+    python tools/bench.py 192.168.1.50 --update        # run and (re)write golden
+    python tools/bench.py 192.168.1.50 --frames 256 --psk secret
+    python tools/bench.py --host tools/hostbench/hostbench --golden tools/hostbench/golden.json
+
+The device renders every effect at 12/50/100/200 pixels with default
+parameters, a fixed clock and a fixed PRNG seed, and reports cycles and ns
+per frame plus a checksum of the final frame. A checksum that differs from
+the golden file means that effect's output changed; a frame that got more
+than --slower percent slower than golden is flagged too. Exit code is 1 if
+anything was flagged, or if there is no usable golden set to compare with
+(missing, a placeholder, or made with other frames/seed); --update writes one.
+
+The run is started and polled over UDP; the finished result (~2 KB, more
+than one datagram) is read from GET /config/api/bench.
+
+Golden results are per-CPU (compare like with like); the default file is
+tools/bench_golden.json next to this script. The host build has its own
+golden set (tools/hostbench/golden.json, `make -C tools/hostbench check`):
+its checksums are the regression baseline, while its timings depend on the
+machine and are only flagged if --slower is given. Host and device
+checksums can differ where an effect's float math rounds differently.
+"""
+import argparse
+import json
+import os
+import socket
+import subprocess
+import sys
+import time
+import urllib.request
+
+MODES = ["Solid", "Breathe", "Color Wipe", "Larson", "Rainbow", "Theater Chase",
+         "Twinkle", "Comet", "Meteor", "Clock Spin", "Plasma", "Fire / Flicker",
+         "Palette Cycle", "Palette Chase"]
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def udp_op(ip, port, payload, psk, timeout=2.0):
+    if psk:
+        payload = dict(payload, key=psk)
+    s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    s.settimeout(timeout)
+    try:
+        s.sendto(json.dumps(payload).encode("utf-8"), (ip, port))
+        data, _ = s.recvfrom(65535)
+        return json.loads(data.decode("utf-8", "ignore"))
+    finally:
+        s.close()
+
+
+def http_json(ip, path, timeout=5.0):
+    with urllib.request.urlopen("http://%s%s" % (ip, path), timeout=timeout) as r:
+        return json.loads(r.read().decode("utf-8", "ignore"))
+
+
+def run_bench(ip, port, frames, psk):
+    j = udp_op(ip, port, {"op": "bench", "run": True, "frames": frames}, psk)
+    if not j.get("ok"):
+        raise RuntimeError("device refused: %s" % j.get("err", j))
+    deadline = time.time() + 60
+    while time.time() < deadline:
+        st = j.get("status", {})
+        if st.get("state") == "done":
+            b = st.get("bench") or http_json(ip, "/config/api/bench").get("bench", {})
+            if "err" in b:
+                raise RuntimeError("bench failed on device: %s" % b["err"])
+            return b
+        time.sleep(0.5)
+        j = udp_op(ip, port, {"op": "bench"}, psk)
+    raise RuntimeError("bench did not finish in time")
+
+
+def run_host(binary, frames):
+    out = subprocess.run([binary, str(frames)], check=True, capture_output=True, text=True).stdout
+    return json.loads(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("ip", nargs="?")
+    ap.add_argument("--host", metavar="BINARY", help="run tools/hostbench's binary instead of a device")
+    ap.add_argument("--port", type=int, default=7777)
+    ap.add_argument("--psk")
+    ap.add_argument("--frames", type=int, default=64)
+    ap.add_argument("--golden", default=os.path.join(HERE, "bench_golden.json"))
+    ap.add_argument("--update", action="store_true", help="write results as the new golden set")
+    ap.add_argument("--slower", type=float, help="flag frames this many %% slower than golden "
+                    "(default 10 on a device, off with --host)")
+    a = ap.parse_args()
+    if not a.host and not a.ip:
+        ap.error("give a device IP or --host")
+    if a.slower is None and not a.host:
+        a.slower = 10.0
+
+    b = run_host(a.host, a.frames) if a.host else run_bench(a.ip, a.port, a.frames, a.psk)
+    rows = {"%d:%d" % (r[0], r[1]): {"cycles": r[2], "ns": r[3], "heap": r[4], "crc": r[5]} for r in b["r"]}
+
+    golden, why = {}, None
+    if a.update:
+        pass
+    elif not os.path.exists(a.golden):
+        why = "no golden file at %s" % a.golden
+    else:
+        with open(a.golden) as f:
+            g = json.load(f)
+        if g.get("placeholder") or not g.get("results"):
+            why = "%s is a placeholder with no results" % a.golden
+        elif g.get("frames") != b["frames"] or g.get("seed") != b["seed"]:
+            why = "golden was made with %s frames / seed %s" % (g.get("frames"), g.get("seed"))
+        else:
+            golden = g["results"]
+
+    bad = 0
+    print("%-15s %5s %10s %10s %6s  %-8s %s" % ("mode", "px", "cyc/frame", "ns/frame", "heap", "crc", ""))
+    for r in b["r"]:
+        key = "%d:%d" % (r[0], r[1])
+        cur, ref = rows[key], golden.get(key)
+        note = ""
+        if ref:
+            if ref["crc"] != cur["crc"]:
+                note = "OUTPUT CHANGED (golden %s)" % ref["crc"]
+            elif a.slower is not None and ref["cycles"] and cur["cycles"] > ref["cycles"] * (1 + a.slower / 100.0):
+                note = "SLOWER (+%.0f%%)" % (100.0 * cur["cycles"] / ref["cycles"] - 100)
+            if note:
+                bad += 1
+        if cur["heap"]:
+            note = (note + "  heap %+d" % cur["heap"]).strip()
+        name = MODES[r[0]] if r[0] < len(MODES) else str(r[0])
+        print("%-15s %5d %10d %10d %6d  %-8s %s" % (name, r[1], cur["cycles"], cur["ns"], cur["heap"], cur["crc"], note))
+
+    print("\n%d frames per case @ %d MHz, seed %d" % (b["frames"], b["mhz"], b["seed"]))
+    if a.update:
+        with open(a.golden, "w") as f:
+            json.dump({"frames": b["frames"], "mhz": b["mhz"], "seed": b["seed"], "results": rows}, f, indent=1, sort_keys=True)
+        print("golden written: %s" % a.golden)
+    elif why:
+        print("error: %s; nothing compared. Run with --update on a known-good build to record one." % why,
+              file=sys.stderr)
+        return 1
+    elif bad:
+        print("%d case(s) flagged" % bad)
+    return 1 if bad else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,74 @@
+// Host-native run of the render benchmark (RGBCtrl benchStart/benchStep):
+// RGBCtrl.cpp and RGBout.cpp are built unchanged against the mocks in
+// mock/, the modules the renderer only talks to (SMBus, UDP, WiFi) are
+// stubbed below, and loop() is driven on a fake clock until the bench is
+// done. The result goes to stdout in the device's format, so
+// tools/bench.py --host compares it with golden.json.
+//
+//   ./hostbench [frames]          (default 64)
+#include <Arduino.h>
+#include <malloc.h>
+#include <chrono>
+#include "../../src/RGBCtrl.h"
+#include "../../src/RGBudp.h"
+#include "../../src/RGBsmbus.h"
+
+uint64_t hostClockUs = 0;
+HardwareSerial Serial;
+EspClass ESP;
+
+uint32_t hostRandom() {
+  static uint32_t x = 0x58524742u;
+  x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+  return x;
+}
+
+// Bytes the host allocator has handed out, as an ESP-style "free" figure:
+// the bench reports the drop across each case.
+uint32_t EspClass::getFreeHeap() {
+  const struct mallinfo2 mi = mallinfo2();
+  return (uint32_t)(0x10000000u - mi.uordblks);
+}
+uint32_t EspClass::getCycleCount() {
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// ---- Modules outside the render path ----
+namespace WiFiMgr {
+  AsyncWebServer& getServer() { static AsyncWebServer s(80); return s; }
+  void sendGzPage(AsyncWebServerRequest*, const uint8_t*, size_t, const String&) {}
+}
+namespace RGBsmbus {
+  SensorValue sensor(Sensor) { return SensorValue{0, false, true, 0}; }
+  void renderBars(float) {}
+  void showBars(bool) {}
+  void statsJson(JsonObject) {}
+}
+namespace RGBCtrlUDP {
+  void processPending(uint32_t) {}
+  uint32_t ddpGaps() { return 0; }
+  void statsJson(JsonObject) {}
+}
+
+int main(int argc, char** argv) {
+  const int frames = argc > 1 ? atoi(argv[1]) : 64;
+  RGBCtrl::begin({ 2, 3, 4, 5 });
+  if (!RGBCtrl::benchStart((uint16_t)frames)) { fprintf(stderr, "bench refused\n"); return 2; }
+
+  // One fake millisecond per pass: frames come due at the configured FPS
+  // and the bench advances one case per frame.
+  for (uint32_t pass = 0; pass < 600000; ++pass) {
+    hostClockUs += 1000;
+    RGBCtrl::loop();
+    const String st = RGBCtrl::benchStatusJson();
+    if (!st.startsWith("{\"state\":\"done\"")) continue;
+    const String prefix = "{\"state\":\"done\",\"bench\":";
+    const String b = st.substring((int)prefix.length(), (int)st.length() - 1);
+    if (b.indexOf("\"err\"") >= 0) { fprintf(stderr, "bench failed: %s\n", b.c_str()); return 2; }
+    printf("%s\n", b.c_str());
+    return 0;
+  }
+  fprintf(stderr, "bench did not finish\n");
+  return 2;
+}
@@ -0,0 +1,42 @@
+// Host mock: a plain GRB byte buffer; show() only counts frames.
+#pragma once
+#include <Arduino.h>
+#include <vector>
+#define NEO_GRB    0x52
+#define NEO_KHZ800 0x0000
+typedef uint16_t neoPixelType;
+
+class Adafruit_NeoPixel {
+public:
+  Adafruit_NeoPixel(uint16_t n, int16_t p = 6, neoPixelType = NEO_GRB + NEO_KHZ800) : pin(p) { updateLength(n); }
+  Adafruit_NeoPixel() {}
+  void begin() {}
+  void show() { ++shows; }
+  bool canShow() { return true; }
+  void setPin(int16_t p) { pin = p; }
+  int16_t getPin() const { return pin; }
+  void updateLength(uint16_t n) { px.assign((size_t)n * 3, 0); }
+  uint16_t numPixels() const { return (uint16_t)(px.size() / 3); }
+  void clear() { std::fill(px.begin(), px.end(), 0); }
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+    if (n >= numPixels()) return;
+    uint8_t* p = &px[(size_t)n * 3]; p[0] = g; p[1] = r; p[2] = b;
+  }
+  void setPixelColor(uint16_t n, uint32_t c) { setPixelColor(n, (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c); }
+  uint32_t getPixelColor(uint16_t n) const {
+    if (n >= numPixels()) return 0;
+    const uint8_t* p = &px[(size_t)n * 3];
+    return ((uint32_t)p[1] << 16) | ((uint32_t)p[0] << 8) | p[2];
+  }
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) { return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b; }
+  void setBrightness(uint8_t b) { bri = b; }
+  uint8_t getBrightness() const { return bri; }
+  uint8_t* getPixels() const { return px.empty() ? nullptr : const_cast<uint8_t*>(px.data()); }
+
+  uint32_t shows = 0;
+
+private:
+  std::vector<uint8_t> px;
+  int16_t pin = -1;
+  uint8_t bri = 0;
+};
@@ -0,0 +1,120 @@
+// Host mock of the Arduino-ESP32 core, just enough to build RGBCtrl.cpp's
+// render path on a PC (tools/hostbench). Time is a fake clock the harness
+// advances (hostClockUs); ESP.getCycleCount() is the real steady clock so
+// benchmark numbers mean something, at a nominal 1000 MHz (1 cycle = 1 ns).
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string>
+
+#define PROGMEM
+#define IRAM_ATTR
+#define HIGH 1
+#define LOW  0
+#define INPUT  0
+#define OUTPUT 1
+typedef bool boolean;
+
+class __FlashStringHelper;
+#define FPSTR(p) (reinterpret_cast<const __FlashStringHelper*>(p))
+#define F(s) FPSTR(s)
+
+class String {
+public:
+  String() {}
+  String(const char* c) : s(c ? c : "") {}
+  String(const char* c, size_t n) : s(c, n) {}
+  String(const __FlashStringHelper* c) : s((const char*)c) {}
+  String(char c) : s(1, c) {}
+  String(int v) : s(std::to_string(v)) {}
+  String(unsigned v) : s(std::to_string(v)) {}
+  String(long v) : s(std::to_string(v)) {}
+  String(unsigned long v) : s(std::to_string(v)) {}
+  String(float v, int d = 2) { fmt(v, d); }
+  String(double v, int d = 2) { fmt(v, d); }
+
+  const char* c_str() const { return s.c_str(); }
+  size_t length() const { return s.size(); }
+  bool isEmpty() const { return s.empty(); }
+  bool reserve(size_t n) { s.reserve(n); return true; }
+  bool concat(const char* c, size_t n) { s.append(c, n); return true; }
+  bool concat(const String& o) { s += o.s; return true; }
+  int indexOf(char c, int from = 0) const { size_t p = s.find(c, from); return p == std::string::npos ? -1 : (int)p; }
+  int indexOf(const char* c, int from = 0) const { size_t p = s.find(c, from); return p == std::string::npos ? -1 : (int)p; }
+  String substring(int a, int b = -1) const { if (b < 0) b = (int)s.size(); return String(s.substr(a, b - a).c_str()); }
+  bool startsWith(const char* o) const { return s.rfind(o, 0) == 0; }
+  bool equals(const char* o) const { return s == o; }
+  int toInt() const { return atoi(s.c_str()); }
+  void trim() {}
+  void replace(const char* a, const char* b) {
+    const size_t la = strlen(a), lb = strlen(b);
+    if (!la) return;
+    for (size_t p = s.find(a); p != std::string::npos; p = s.find(a, p + lb)) s.replace(p, la, b);
+  }
+  char operator[](size_t i) const { return s[i]; }
+  String& operator+=(const String& o) { s += o.s; return *this; }
+  String& operator+=(const char* o) { s += o; return *this; }
+  String& operator+=(char o) { s += o; return *this; }
+  bool operator==(const String& o) const { return s == o.s; }
+  bool operator==(const char* o) const { return s == o; }
+  bool operator!=(const String& o) const { return s != o.s; }
+  bool operator!=(const char* o) const { return s != o; }
+
+private:
+  void fmt(double v, int d) { char b[48]; snprintf(b, sizeof(b), "%.*f", d, v); s = b; }
+  std::string s;
+};
+inline String operator+(const String& a, const String& b) { String r = a; r += b; return r; }
+inline String operator+(const String& a, const char* b)   { String r = a; r += b; return r; }
+inline String operator+(const char* a, const String& b)   { String r(a); r += b; return r; }
+
+extern uint64_t hostClockUs;     // fake clock, advanced by the harness
+inline uint32_t millis()  { return (uint32_t)(hostClockUs / 1000); }
+inline uint32_t micros()  { return (uint32_t)hostClockUs; }
+inline void delay(uint32_t ms) { hostClockUs += (uint64_t)ms * 1000; }
+inline void delayMicroseconds(uint32_t us) { hostClockUs += us; }
+inline void yield() {}
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int  digitalRead(uint8_t) { return 0; }
+
+uint32_t hostRandom();           // deterministic xorshift (hostbench.cpp)
+inline long random(long hi) { return hi > 0 ? (long)(hostRandom() % (uint32_t)hi) : 0; }
+inline long random(long lo, long hi) { return hi > lo ? lo + random(hi - lo) : lo; }
+
+class Print {
+public:
+  size_t printf(const char*, ...) { return 0; }
+  size_t print(const char*) { return 0; }
+  size_t print(const String&) { return 0; }
+  size_t print(int) { return 0; }
+  size_t println(const char* = "") { return 0; }
+  size_t println(const String&) { return 0; }
+  size_t println(int) { return 0; }
+  size_t write(const uint8_t*, size_t n) { return n; }
+};
+class HardwareSerial : public Print { public: void begin(int) {} };
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+  uint32_t getFreeHeap();                      // host heap in use, from mallinfo2()
+  uint32_t getMinFreeHeap()  { return getFreeHeap(); }
+  uint32_t getMaxAllocHeap() { return getFreeHeap(); }
+  uint32_t getCycleCount();                    // steady clock, ns
+  uint32_t getCpuFreqMHz()   { return 1000; }
+  void restart() { exit(0); }
+};
+extern EspClass ESP;
+
+template<class T> const T& min(const T& a, const T& b) { return a < b ? a : b; }
+template<class T> const T& max(const T& a, const T& b) { return a > b ? a : b; }
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
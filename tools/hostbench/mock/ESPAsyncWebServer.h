@@ -0,0 +1,71 @@
+// Host mock: routes are accepted and never called.
+#pragma once
+#include <Arduino.h>
+#include <functional>
+typedef enum { HTTP_GET = 1, HTTP_POST = 2, HTTP_DELETE = 4, HTTP_PUT = 8, HTTP_PATCH = 16,
+               HTTP_HEAD = 32, HTTP_OPTIONS = 64, HTTP_ANY = 127 } WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebServerResponse {
+public:
+  void addHeader(const char*, const char*) {}
+  void addHeader(const String&, const String&) {}
+  void setCode(int) {}
+};
+class AsyncWebParameter { public: const String& value() const { return v; } String v; };
+class AsyncWebHeader    { public: const String& value() const { return v; } String v; };
+class AsyncWebServerRequest {
+public:
+  void* _tempObject = nullptr;
+  template<class... A> void send(A&&...) {}
+  template<class... A> AsyncWebServerResponse* beginResponse(A&&...) { return &resp; }
+  template<class... A> AsyncWebServerResponse* beginResponse_P(A&&...) { return &resp; }
+  bool hasParam(const char*, bool = false) const { return false; }
+  AsyncWebParameter* getParam(const char*, bool = false) const { return nullptr; }
+  bool hasHeader(const char*) const { return false; }
+  AsyncWebHeader* getHeader(const char*) const { return nullptr; }
+  WebRequestMethodComposite method() const { return HTTP_GET; }
+  const String& url() const { return u; }
+  void onDisconnect(std::function<void()>) {}
+private:
+  AsyncWebServerResponse resp;
+  String u;
+};
+typedef std::function<void(AsyncWebServerRequest*)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, const String&, size_t, uint8_t*, size_t, bool)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, uint8_t*, size_t, size_t, size_t)> ArBodyHandlerFunction;
+
+class AsyncWebHandler {};
+class AsyncCallbackWebHandler : public AsyncWebHandler {};
+class AsyncWebSocketClient {
+public:
+  uint32_t id() { return 0; }
+  void text(const char*, size_t) {}
+  void text(const String&) {}
+  bool canSend() { return true; }
+};
+typedef enum { WS_EVT_CONNECT, WS_EVT_DISCONNECT, WS_EVT_PONG, WS_EVT_ERROR, WS_EVT_DATA } AwsEventType;
+typedef enum { WS_CONTINUATION, WS_TEXT, WS_BINARY, WS_DISCONNECT = 0x08, WS_PING, WS_PONG } AwsFrameType;
+typedef struct { uint8_t message_opcode; uint32_t num; uint8_t final; uint8_t masked; uint8_t opcode;
+                 uint64_t len; uint8_t mask[4]; uint64_t index; } AwsFrameInfo;
+class AsyncWebSocket : public AsyncWebHandler {
+public:
+  typedef std::function<void(AsyncWebSocket*, AsyncWebSocketClient*, AwsEventType, void*, uint8_t*, size_t)> AwsEventHandler;
+  explicit AsyncWebSocket(const String&) {}
+  void onEvent(AwsEventHandler) {}
+  void textAll(const char*, size_t) {}
+  void textAll(const String&) {}
+  void cleanupClients(uint16_t = 8) {}
+  size_t count() const { return 0; }
+  bool availableForWriteAll() { return true; }
+};
+class AsyncWebServer {
+public:
+  explicit AsyncWebServer(uint16_t) {}
+  template<class... A> AsyncCallbackWebHandler& on(const char*, WebRequestMethodComposite, A&&...) { return h; }
+  void onNotFound(ArRequestHandlerFunction) {}
+  void begin() {}
+  AsyncWebHandler& addHandler(AsyncWebHandler* x) { return *x; }
+private:
+  AsyncCallbackWebHandler h;
+};
@@ -0,0 +1,19 @@
+// Host mock: empty NVS that forgets writes, so every run boots on defaults.
+#pragma once
+#include <Arduino.h>
+class Preferences {
+public:
+  bool begin(const char*, bool = false) { return true; }
+  void end() {}
+  bool isKey(const char*) { return false; }
+  bool remove(const char*) { return true; }
+  String getString(const char*, const String& d = String()) { return d; }
+  size_t putString(const char*, const String& v) { return v.length(); }
+  size_t getBytesLength(const char*) { return 0; }
+  size_t getBytes(const char*, void*, size_t) { return 0; }
+  size_t putBytes(const char*, const void*, size_t n) { return n; }
+  uint8_t getUChar(const char*, uint8_t d = 0) { return d; }
+  size_t putUChar(const char*, uint8_t) { return 1; }
+  bool getBool(const char*, bool d = false) { return d; }
+  size_t putBool(const char*, bool) { return 1; }
+};
@@ -0,0 +1,4 @@
+#pragma once
+#include <stdint.h>
+extern uint64_t hostClockUs;
+inline int64_t esp_timer_get_time() { return (int64_t)hostClockUs; }
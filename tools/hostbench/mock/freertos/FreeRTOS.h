@@ -0,0 +1,20 @@
+// Host mock: single-threaded, so locks and critical sections are no-ops.
+#pragma once
+#include <stdint.h>
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  1
+#define portMAX_DELAY 0xffffffffu
+#define pdMS_TO_TICKS(x) (x)
+#define portTICK_PERIOD_MS 1
+typedef struct { int x; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(m)     (void)(m)
+#define portEXIT_CRITICAL(m)      (void)(m)
+#define portENTER_CRITICAL_ISR(m) (void)(m)
+#define portEXIT_CRITICAL_ISR(m)  (void)(m)
+#define ARDUINO_RUNNING_CORE 1
+#define tskNO_AFFINITY 0x7fffffff
@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+"""
+Regenerate the gzip'd web pages embedded in the firmware.
+
+    python tools/webgz.py
+
+Edit the pages in web/, run this, and commit the regenerated src/web_*.h
+headers with them. Output is deterministic (no gzip timestamp), so an
+unchanged page produces an unchanged header and the same ETag.
+"""
+import gzip
+import os
+import zlib
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# (source page, generated header, C symbol prefix)
+PAGES = [
+    ("web/config.html", "src/web_config.h", "CONFIG_HTML"),
+    ("web/ota.html",    "src/web_ota.h",    "OTA_HTML"),
+]
+
+
+def emit(src, dst, sym):
+    with open(os.path.join(ROOT, src), "rb") as f:
+        raw = f.read()
+    gz = gzip.compress(raw, compresslevel=9, mtime=0)
+    etag = "%08x" % (zlib.crc32(gz) & 0xFFFFFFFF)
+
+    out = []
+    out.append("// Generated by tools/webgz.py from %s -- do not edit by hand." % src)
+    out.append("#pragma once")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("// %u bytes raw, %u gzip'd" % (len(raw), len(gz)))
+    out.append('static const char    %s_ETAG[]  = "%s";' % (sym, etag))
+    out.append("static const size_t  %s_GZ_LEN  = %u;" % (sym, len(gz)))
+    out.append("static const uint8_t %s_GZ[] PROGMEM = {" % sym)
+    for i in range(0, len(gz), 16):
+        out.append("  " + ",".join("0x%02x" % b for b in gz[i:i + 16]) + ",")
+    out.append("};")
+    out.append("")
+
+    with open(os.path.join(ROOT, dst), "w", newline="\n") as f:
+        f.write("\n".join(out))
+    print("%-16s -> %-18s %6u -> %5u bytes  etag %s" % (src, dst, len(raw), len(gz), etag))
+
+
+if __name__ == "__main__":
+    for p in PAGES:
+        emit(*p)